@@ -147,8 +147,20 @@ namespace behaviac
 
         /**
         to respond to event 'btEvent' to switch to the corresonding behavior tree
+
+        all the running tasks of the current behavior tree listening to 'btEvent' are visited, the innermost first.
+        it includes the running children of Parallel and SelectorLoop, which keep their own current tasks and
+        so were not reached by walking the current tasks from the tree as it was done before the listeners were indexed.
+        @sa HasEventListeners
         */
         void btonevent(const char* btEvent);
+
+        /**
+        return true if any running task of this agent has an event 'eventId' attached.
+
+        the index is maintained when the tasks are entered and exited.
+        */
+        bool HasEventListeners(const CStringID& eventId) const;
         ///////////////////////////////////////////////////////////////////////////////////////
         ///////////////////////////////////////////////////////////////////////////////////////
         int GetId() const
@@ -232,16 +244,21 @@ namespace behaviac
         template<class ParamType1, class ParamType2, class ParamType3>
         static void FireEvent(Agent* pAgent, const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3);
 
-        //static void FireEvent(int contextId, const char* eventName);
+        /**
+        fire the event to all the agents in the context 'contextId' which are listening to it.
 
-        //template<class ParamType1>
-        //static void FireEvent(int contextId, const char* eventName, const ParamType1& param1);
+        only the agents with any running task which has the event attached are visited.
+        */
+        static void FireEvent(int contextId, const char* eventName);
 
-        //template<class ParamType1, class ParamType2>
-        //static void FireEvent(int contextId, const char* eventName, const ParamType1& param1, const ParamType2& param2);
+        template<class ParamType1>
+        static void FireEvent(int contextId, const char* eventName, const ParamType1& param1);
+
+        template<class ParamType1, class ParamType2>
+        static void FireEvent(int contextId, const char* eventName, const ParamType1& param1, const ParamType2& param2);
 
-        //template<class ParamType1, class ParamType2, class ParamType3>
-        //static void FireEvent(int contextId, const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3);
+        template<class ParamType1, class ParamType2, class ParamType3>
+        static void FireEvent(int contextId, const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3);
 
         void FireEvent(const char* eventName);
 
@@ -254,6 +271,25 @@ namespace behaviac
         template<class ParamType1, class ParamType2, class ParamType3>
         void FireEvent(const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3);
 
+        /**
+        post the event to be fired to this agent in the next Workspace::Update.
+
+        unlike FireEvent, it can be called from any thread, even when the agents are being executed,
+        as long as the agent and its context are not destroyed meanwhile.
+        the events posted to the same agent from the same thread are fired in the posting order.
+        @sa Context::execEvents
+        */
+        void PostEvent(const char* eventName);
+
+        template<class ParamType1>
+        void PostEvent(const char* eventName, const ParamType1& param1);
+
+        template<class ParamType1, class ParamType2>
+        void PostEvent(const char* eventName, const ParamType1& param1, const ParamType2& param2);
+
+        template<class ParamType1, class ParamType2, class ParamType3>
+        void PostEvent(const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3);
+
         bool IsFired(const char* eventName);
         static void ResetEvent(Agent* pAgent, const char* eventName);
         //static void ResetEvent(int contextId, const char* eventName);
@@ -525,6 +561,14 @@ namespace behaviac
 
         CNamedEvent* findEvent(const char* eventName);
 
+        void AddEventListener(const CStringID& eventId, BehaviorTask* pTask, uint32_t eventIndex);
+        void RemoveEventListener(BehaviorTask* pTask);
+        void ClearEventListeners();
+        bool IsEventListener(const CStringID& eventId, const BehaviorTask* pTask, uint32_t eventIndex) const;
+
+        //access AddEventListener and RemoveEventListener
+        friend class BehaviorTask;
+
         //access ExportMetas and Cleanup
         friend class Workspace;
         static bool ExportMetas(const char* xmlMetaFilePath);
@@ -642,6 +686,18 @@ namespace behaviac
         ///////////////////////////////////////////////////////////////////////////////////////
         AgentEvents_t				m_eventInfos;
 
+        struct EventListener_t
+        {
+            BehaviorTask*	task;
+            //the index in the events of the task's node, the node might be replaced by the hot reload
+            uint32_t		eventIndex;
+        };
+
+        //event id -> the running tasks which have that event attached
+        typedef behaviac::vector<EventListener_t> EventListenerTasks_t;
+        typedef behaviac::map<CStringID, EventListenerTasks_t> EventListeners_t;
+        EventListeners_t			m_eventListeners;
+
         struct BehaviorTreeStackItem_t
         {
             BehaviorTreeTask*	bt;
@@ -676,6 +732,95 @@ namespace behaviac
         int                         m_planningTop;
         static uint32_t				ms_idMask;
     };
+
+    /**
+    an event posted by Agent::PostEvent, it keeps a copy of the parameters until it is fired by Context::execEvents
+    */
+    class BEHAVIAC_API DeferredEvent
+    {
+    public:
+        BEHAVIAC_DECLARE_MEMORY_OPERATORS(DeferredEvent);
+
+        DeferredEvent(const Agent* pAgent, const char* eventName) : m_agentId(pAgent->GetId()), m_eventName(eventName), m_next(0)
+        {}
+
+        virtual ~DeferredEvent()
+        {}
+
+        int GetAgentId() const
+        {
+            return this->m_agentId;
+        }
+
+        virtual void Fire(Agent* pAgent) const
+        {
+            Agent::FireEvent(pAgent, this->m_eventName.c_str());
+        }
+
+    protected:
+        int					m_agentId;
+        behaviac::string	m_eventName;
+
+    private:
+        //the next one in the context's posted list
+        DeferredEvent*		m_next;
+
+        //access m_next
+        friend class Context;
+    };
+
+    template<class ParamType1>
+    class DeferredEvent1 : public DeferredEvent
+    {
+    public:
+        DeferredEvent1(const Agent* pAgent, const char* eventName, const ParamType1& param1) : DeferredEvent(pAgent, eventName), m_param1(param1)
+        {}
+
+        virtual void Fire(Agent* pAgent) const
+        {
+            Agent::FireEvent(pAgent, this->m_eventName.c_str(), this->m_param1);
+        }
+
+    private:
+        ParamType1	m_param1;
+    };
+
+    template<class ParamType1, class ParamType2>
+    class DeferredEvent2 : public DeferredEvent
+    {
+    public:
+        DeferredEvent2(const Agent* pAgent, const char* eventName, const ParamType1& param1, const ParamType2& param2) :
+            DeferredEvent(pAgent, eventName), m_param1(param1), m_param2(param2)
+        {}
+
+        virtual void Fire(Agent* pAgent) const
+        {
+            Agent::FireEvent(pAgent, this->m_eventName.c_str(), this->m_param1, this->m_param2);
+        }
+
+    private:
+        ParamType1	m_param1;
+        ParamType2	m_param2;
+    };
+
+    template<class ParamType1, class ParamType2, class ParamType3>
+    class DeferredEvent3 : public DeferredEvent
+    {
+    public:
+        DeferredEvent3(const Agent* pAgent, const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3) :
+            DeferredEvent(pAgent, eventName), m_param1(param1), m_param2(param2), m_param3(param3)
+        {}
+
+        virtual void Fire(Agent* pAgent) const
+        {
+            Agent::FireEvent(pAgent, this->m_eventName.c_str(), this->m_param1, this->m_param2, this->m_param3);
+        }
+
+    private:
+        ParamType1	m_param1;
+        ParamType2	m_param2;
+        ParamType3	m_param3;
+    };
     /*! @} */
     /*! @} */
 }
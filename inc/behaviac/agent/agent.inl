@@ -240,6 +240,53 @@ namespace behaviac
         }
     }
 
+    BEHAVIAC_FORCEINLINE void Agent::FireEvent(int contextId, const char* eventName)
+    {
+        behaviac::vector<Agent*> listeners;
+        Context::GetContext(contextId).GetEventListeners(eventName, listeners);
+
+        for (uint32_t i = 0; i < listeners.size(); ++i)
+        {
+            Agent::FireEvent(listeners[i], eventName);
+        }
+    }
+
+    template<class ParamType1>
+    BEHAVIAC_FORCEINLINE void Agent::FireEvent(int contextId, const char* eventName, const ParamType1& param1)
+    {
+        behaviac::vector<Agent*> listeners;
+        Context::GetContext(contextId).GetEventListeners(eventName, listeners);
+
+        for (uint32_t i = 0; i < listeners.size(); ++i)
+        {
+            Agent::FireEvent(listeners[i], eventName, param1);
+        }
+    }
+
+    template<class ParamType1, class ParamType2>
+    BEHAVIAC_FORCEINLINE void Agent::FireEvent(int contextId, const char* eventName, const ParamType1& param1, const ParamType2& param2)
+    {
+        behaviac::vector<Agent*> listeners;
+        Context::GetContext(contextId).GetEventListeners(eventName, listeners);
+
+        for (uint32_t i = 0; i < listeners.size(); ++i)
+        {
+            Agent::FireEvent(listeners[i], eventName, param1, param2);
+        }
+    }
+
+    template<class ParamType1, class ParamType2, class ParamType3>
+    BEHAVIAC_FORCEINLINE void Agent::FireEvent(int contextId, const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3)
+    {
+        behaviac::vector<Agent*> listeners;
+        Context::GetContext(contextId).GetEventListeners(eventName, listeners);
+
+        for (uint32_t i = 0; i < listeners.size(); ++i)
+        {
+            Agent::FireEvent(listeners[i], eventName, param1, param2, param3);
+        }
+    }
+
     BEHAVIAC_FORCEINLINE void Agent::FireEvent(const char* eventName)
     {
         Agent::FireEvent(this, eventName);
@@ -263,6 +310,29 @@ namespace behaviac
         Agent::FireEvent(this, eventName, param1, param2, param3);
     }
 
+    BEHAVIAC_FORCEINLINE void Agent::PostEvent(const char* eventName)
+    {
+        Context::PostEvent(this->GetContextId(), BEHAVIAC_NEW DeferredEvent(this, eventName));
+    }
+
+    template<class ParamType1>
+    BEHAVIAC_FORCEINLINE void Agent::PostEvent(const char* eventName, const ParamType1& param1)
+    {
+        Context::PostEvent(this->GetContextId(), BEHAVIAC_NEW DeferredEvent1<ParamType1>(this, eventName, param1));
+    }
+
+    template<class ParamType1, class ParamType2>
+    BEHAVIAC_FORCEINLINE void Agent::PostEvent(const char* eventName, const ParamType1& param1, const ParamType2& param2)
+    {
+        Context::PostEvent(this->GetContextId(), BEHAVIAC_NEW DeferredEvent2<ParamType1, ParamType2>(this, eventName, param1, param2));
+    }
+
+    template<class ParamType1, class ParamType2, class ParamType3>
+    BEHAVIAC_FORCEINLINE void Agent::PostEvent(const char* eventName, const ParamType1& param1, const ParamType2& param2, const ParamType3& param3)
+    {
+        Context::PostEvent(this->GetContextId(), BEHAVIAC_NEW DeferredEvent3<ParamType1, ParamType2, ParamType3>(this, eventName, param1, param2, param3));
+    }
+
     BEHAVIAC_API bool IsParVar(const char* variableName);
 
     BEHAVIAC_FORCEINLINE bool Agent::IsVariableExisting(const char* variableName) const
@@ -660,6 +730,7 @@ namespace behaviac
             IVariable* pVar = (IVariable*)it->second;
 
             pVar->SetFromString(pAgent, pMember, valueStr);
+            pVar->m_version = ++this->m_version;
         }
     }
 
@@ -701,6 +772,7 @@ namespace behaviac
             }
 
             pVar = BEHAVIAC_NEW VariableTypeType(pMember, variableName, varId);
+            pVar->m_version = ++this->m_version;
             m_variables[varId] = pVar;
         }
         else
@@ -715,7 +787,10 @@ namespace behaviac
             //	pVar->GetTypeId() == GetClassTypeNumberId<VariableType>());
         }
 
-        pVar->SetValue(value, pAgent);
+        if (pVar->SetValue(value, pAgent))
+        {
+            pVar->m_version = ++this->m_version;
+        }
     }
 
     template<typename VariableType>
@@ -21,6 +21,7 @@
 #include "behaviac/base/object/tagobject.h"
 #include "behaviac/base/core/string/stringid.h"
 #include "behaviac/base/string/stringutils.h"
+#include "behaviac/base/core/thread/mutex.h"
 
 #include "behaviac/behaviortree/behaviortree_task.h"
 #include "behaviac/agent/state.h"
@@ -33,6 +34,7 @@ namespace behaviac
     class Variables;
     class State_t;
     class CNamedEvent;
+    class DeferredEvent;
 
     /*! \addtogroup Agent
     * @{
@@ -50,6 +52,9 @@ namespace behaviac
 
         static Contexts_t* ms_contexts;
 
+        //guards the changes of ms_contexts against FindContext, the main thread reads it without the lock
+        static behaviac::Mutex ms_contextsCs;
+
         void LogCurrentState();
 
     public:
@@ -57,7 +62,26 @@ namespace behaviac
         void RemoveAgent(Agent* pAgent);
         void AddAgent(Agent* pAgent);
         static void execAgents(int contextId);
+
+        /**
+        fire the events posted to the specified context, the events are delivered in batches grouped by agent.
+        it is called by Workspace::Update before the agents are executed.
+
+        contextId = -1, it fires the events of all the contexts
+        */
+        static void execEvents(int contextId);
+
+        /**
+        get the specified context, it is created if it doesn't exist yet.
+        creating contexts is not thread safe, so the contexts should be created before other threads post events to them.
+        */
         static Context& GetContext(int contextId);
+
+        /**
+        get the specified context without creating it, 0 if it doesn't exist.
+        unlike GetContext, it can be called from any thread, as long as the context is not cleaned up meanwhile.
+        */
+        static Context* FindContext(int contextId);
         template<typename VariableType>
         const VariableType* GetStaticVariable(const char* staticClassName, uint32_t variableId)
         {
@@ -100,6 +124,24 @@ namespace behaviac
         template<typename VariableType>
         void SetStaticVariable(const CMemberBase* pMember, const char* variableName, const VariableType& value, const char* staticClassName, uint32_t varableId);
 
+        /**
+        get the agents which have any running task listening to the event 'eventName'.
+
+        the listeners are copied out as firing the event might switch the trees and so change the index.
+        */
+        void GetEventListeners(const char* eventName, behaviac::vector<Agent*>& listeners) const;
+
+        /**
+        queue the event to be fired by execEvents, the context takes the ownership of 'pEvent'.
+
+        it is lock free so that events can be posted from any thread while the agents are being executed.
+        the static one posts it to the context 'contextId' found by FindContext, which only locks the lookup,
+        the event is dropped if there is no such context.
+        @sa Agent::PostEvent
+        */
+        void PostEvent(DeferredEvent* pEvent);
+        static void PostEvent(int contextId, DeferredEvent* pEvent);
+
         const CNamedEvent* FindEventStatic(const char* eventName, const char* className);
         void InsertEventGlobal(const char* className, CNamedEvent* pEvent);
         CNamedEvent* FindNamedEventTemplate(const CTagObject::MethodsContainer& methods, const char* eventName);
@@ -122,6 +164,30 @@ namespace behaviac
 
         Agent* GetInstance(const char* agentInstanceName);
 
+        /**
+        timeSinceStartup, deltaTime and deltaFrames used by the agents of this context.
+
+        by default a context uses the clock of the Workspace. once any of them is set, the context keeps its own clock
+        so that several independent simulations sharing the loaded trees can be executed, each with its own context, at their own pace,
+        even on separate threads, see Workspace::CreateBehaviorTreeTask.
+        @sa Workspace::SetTimeSinceStartup
+        */
+        void SetTimeSinceStartup(float timeSinceStartup);
+        float GetTimeSinceStartup() const;
+
+        void SetDeltaFrameTime(float deltaTime);
+        float GetDeltaFrameTime() const;
+
+        void SetDeltaFrames(int deltaFrames);
+        int GetDeltaFrames() const;
+
+        /**
+        the times the action of 'actionString' is executed by the agents of this context,
+        a breakpoint with a hit count is hit by each context on its own.
+        */
+        int UpdateActionCount(const char* actionString);
+        int GetActionCount(const char* actionString) const;
+
         bool Save(States_t& states);
         bool Load(const States_t& states);
 
@@ -161,6 +227,15 @@ namespace behaviac
         void CleanupInstances();
 
         void execAgents_();
+        void execEvents_();
+
+        Agent* FindAgent(int agentId);
+
+        void AddEventListener(const CStringID& eventId, Agent* pAgent);
+        void RemoveEventListener(const CStringID& eventId, Agent* pAgent);
+
+        //access AddEventListener and RemoveEventListener
+        friend class Agent;
     private:
         typedef behaviac::map<behaviac::string, Agent*> NamedAgents_t;
         NamedAgents_t m_namedAgents;
@@ -172,8 +247,28 @@ namespace behaviac
         typedef behaviac::map<behaviac::string, AgentEvents_t> AgentStaticEvents_t;
         AgentStaticEvents_t	ms_eventInfosGlobal;
 
+        //event id -> the agents which have any running task listening to it
+        typedef behaviac::map<CStringID, Agents_t> EventListeners_t;
+        EventListeners_t	m_eventListeners;
+
+        //the posted events in the reverse posting order, pushed by the posting threads with a compare and swap,
+        //and taken all at once by execEvents
+        DeferredEvent* volatile m_postedEvents;
+        behaviac::vector<DeferredEvent*> m_firingEvents;
+
         int     m_context_id;
         bool    m_bCreatedByMe;
+
+        //the own clock, only used after it is set
+        bool    m_bOwnClock;
+        float   m_timeSinceStartup;
+        float   m_deltaTime;
+        int     m_deltaFrames;
+
+        void UseOwnClock();
+
+        typedef behaviac::map<CStringID, int> ActionCount_t;
+        ActionCount_t	m_actions_count;
     };
     /*! @} */
     /*! @} */
@@ -0,0 +1,38 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef BEHAVIAC_BASE_LZ_H
+#define BEHAVIAC_BASE_LZ_H
+
+#include "behaviac/base/core/config.h"
+
+/**
+a small LZ77 codec of the lz4 family, used to compress the exported files.
+
+the compressed data is a sequence of tokens, each of which has the literals and then a match of at least 4 bytes
+at an offset up to 64k back, the last token only has the literals.
+*/
+namespace LZ
+{
+    //the maximum size of the compressed data of 'size' bytes
+    BEHAVIAC_API uint32_t CompressBound(uint32_t size);
+
+    //return the size of the compressed data, 0 if 'dstCapacity' is not big enough
+    BEHAVIAC_API uint32_t Compress(const char* src, uint32_t srcSize, char* dst, uint32_t dstCapacity);
+
+    //return false if 'src' is corrupted or it is not decompressed to exactly 'dstSize' bytes
+    BEHAVIAC_API bool Decompress(const char* src, uint32_t srcSize, char* dst, uint32_t dstSize);
+}
+
+#endif // #ifndef BEHAVIAC_BASE_LZ_H
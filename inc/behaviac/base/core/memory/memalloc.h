@@ -147,6 +147,12 @@ namespace behaviac
 
     /// Call this function to cleanup the Allocator used by default
     BEHAVIAC_API void CleanupDefaultMemoryAllocator();
+
+    /// Returns the bytes allocated minus the bytes freed by the calling thread through the default allocator
+    /*! the allocations of the other threads don't change it. it is only tracked when the default allocator
+    tracks its allocated size, otherwise it is always 0.
+    */
+    BEHAVIAC_API int64_t GetThreadAllocatedSize();
 }
 
 #define BEHAVIAC_ALLOCATOR_MALLOC_WITHBEHAVIAC_FILELINE(allocator, size, tag, file, line)							(allocator)->Alloc(size, tag, file, line)
@@ -29,6 +29,17 @@ namespace behaviac
         {
         }
         virtual IAsyncValue* clone() = 0;
+
+        /**
+        create a new value of the same type, unlike clone, it doesn't share the value with this one
+        */
+        virtual IAsyncValue* create() const = 0;
+
+        /**
+        the address of the value to be written directly, the value is regarded as set.
+        return 0 for void.
+        */
+        virtual void* GetValueAddress() = 0;
         virtual bool IsVoid() const = 0;
         virtual void GetTypeName(behaviac::string& typeName) = 0;
         virtual const char* GetString() const = 0;
@@ -64,6 +75,8 @@ namespace behaviac
     public:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(AsyncValue<T>);
 
+        typedef TTYPE ValueType;
+
         inline AsyncValue() : mValue(BEHAVIAC_NEW Value(T(), false))
         {
         }
@@ -113,6 +126,17 @@ namespace behaviac
             return BEHAVIAC_NEW AsyncValue(*this);
         }
 
+        virtual IAsyncValue* create() const
+        {
+            return BEHAVIAC_NEW AsyncValue();
+        }
+
+        virtual void* GetValueAddress()
+        {
+            mValue->set = true;
+            return &mValue->value;
+        }
+
         virtual bool IsVoid() const
         {
             return false;
@@ -141,6 +165,8 @@ namespace behaviac
     public:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(AsyncValue<void>);
 
+        typedef void ValueType;
+
         inline AsyncValue()
         {
         }
@@ -162,6 +188,16 @@ namespace behaviac
             return BEHAVIAC_NEW AsyncValue(*this);
         }
 
+        virtual IAsyncValue* create() const
+        {
+            return BEHAVIAC_NEW AsyncValue();
+        }
+
+        virtual void* GetValueAddress()
+        {
+            return 0;
+        }
+
         virtual bool IsVoid() const
         {
             return true;
@@ -206,6 +242,8 @@ namespace behaviac
     public:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(AsyncValue<const char*>);
 
+        typedef const char* ValueType;
+
         inline AsyncValue() : mValue(BEHAVIAC_NEW Value(0, false))
         {
         }
@@ -254,6 +292,17 @@ namespace behaviac
             return BEHAVIAC_NEW AsyncValue(*this);
         }
 
+        virtual IAsyncValue* create() const
+        {
+            return BEHAVIAC_NEW AsyncValue();
+        }
+
+        virtual void* GetValueAddress()
+        {
+            mValue->set = true;
+            return &mValue->value;
+        }
+
         virtual bool IsVoid() const
         {
             return false;
@@ -302,6 +351,8 @@ namespace behaviac
     public:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(AsyncValue<char*>);
 
+        typedef char* ValueType;
+
         inline AsyncValue() : mValue(BEHAVIAC_NEW Value(0, false))
         {
         }
@@ -350,6 +401,17 @@ namespace behaviac
             return BEHAVIAC_NEW AsyncValue(*this);
         }
 
+        virtual IAsyncValue* create() const
+        {
+            return BEHAVIAC_NEW AsyncValue();
+        }
+
+        virtual void* GetValueAddress()
+        {
+            mValue->set = true;
+            return &mValue->value;
+        }
+
         virtual bool IsVoid() const
         {
             return false;
@@ -400,6 +462,8 @@ namespace behaviac
     public:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(AsyncValue<behaviac::string>);
 
+        typedef behaviac::string ValueType;
+
         inline AsyncValue() : mValue(BEHAVIAC_NEW Value(behaviac::string(), false))
         {
         }
@@ -448,6 +512,17 @@ namespace behaviac
             return BEHAVIAC_NEW AsyncValue(*this);
         }
 
+        virtual IAsyncValue* create() const
+        {
+            return BEHAVIAC_NEW AsyncValue();
+        }
+
+        virtual void* GetValueAddress()
+        {
+            mValue->set = true;
+            return &mValue->value;
+        }
+
         virtual bool IsVoid() const
         {
             return false;
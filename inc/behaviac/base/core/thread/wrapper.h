@@ -71,6 +71,9 @@ namespace behaviac
     Atomic32 AtomicInc(volatile Atomic32& i);
     Atomic32 AtomicDec(volatile Atomic32& i);
 
+    // Returns the initial value of p, 'v' is stored only if it was 'comparand'
+    void* AtomicCompareExchangePointer(void* volatile& p, void* v, void* comparand);
+
     template<typename T>
     class ScopedInt
     {
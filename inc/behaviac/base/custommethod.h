@@ -100,10 +100,11 @@ namespace behaviac
             return BEHAVIAC_NEW CNamedEvent(*this);
         }
 
-        virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+        virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
         {
             BEHAVIAC_UNUSED_VAR(parent);
             BEHAVIAC_UNUSED_VAR(parHolder);
+            BEHAVIAC_UNUSED_VAR(pResult);
         }
 
         virtual bool IsNamedEvent() const
@@ -53,6 +53,13 @@ public:
     virtual bool FileExists(behaviac::string filePath, behaviac::string ext);
 
     virtual uint64_t FileGetSize(const char* fileName);
+
+    /**
+    map the file read only into the memory, the data is not null terminated.
+    override it to return 0 if your files are not plain files on the disk, then the file is read by FileOpen.
+    */
+    virtual const char* FileMap(const char* fileName, uint32_t& fileSize);
+    virtual void FileUnmap(const char* pData, uint32_t fileSize);
     virtual behaviac::wstring GetCurrentWorkingDirectory();
 
     bool PathIsRelative(const behaviac::string& path);
@@ -126,6 +126,14 @@ public:
 
     static uint64_t GetFileSize(Handle hFile);
 
+    /**
+    map the whole file read only into the memory, the data is not null terminated.
+
+    @return 0 if it fails or it is not supported on the platform
+    */
+    static const char* MapFile(const char* szFullPath, uint32_t& fileSize);
+    static void UnmapFile(const char* pData, uint32_t fileSize);
+
     static bool Delete(const char* szPath, bool bRecursive);
 
     static bool Move(const char* srcFullPath, const char* destFullPath);
@@ -79,10 +79,33 @@ struct SaveToXMLDispatcher<MemberType, true>
     }
 };
 
+/**
+the caller owned storage of an argument which needs none, see ParamVariableStruct::ValueStorage_t
+*/
+struct ParamNoValueStorage_t
+{
+};
+
+/**
+the caller owned copy of a literal argument passed to a non const reference,
+so that the method writes to the copy instead of the value loaded into the node
+*/
+template <typename T>
+struct ParamOutValueStorage_t
+{
+    T value;
+};
+
 template <typename T>
 class ParamVariablePrimitiveBase
 {
 public:
+    /**
+    the storage 'GetValue' evaluates the argument into, it is a local of the caller so that the call is reentrant.
+    only a struct assembled from properties needs it, the other arguments are returned from where they are kept.
+    */
+    typedef ParamNoValueStorage_t ValueStorage_t;
+
     ParamVariablePrimitiveBase() : bDefaultValid(false), prop(0)
     {}
 
@@ -213,6 +236,15 @@ public:
 
     const T& GetValue(const CTagObject* parent, const CTagObject* parHolder) const;
 
+    const T& GetValue(const CTagObject* parent, const CTagObject* parHolder, ParamNoValueStorage_t& storage) const
+    {
+        BEHAVIAC_UNUSED_VAR(storage);
+
+        return this->GetValue(parent, parHolder);
+    }
+
+    const T& GetValue(const CTagObject* parent, const CTagObject* parHolder, ParamOutValueStorage_t<T>& storage) const;
+
     void SetValue(const T& v)
     {
         this->bDefaultValid = true;
@@ -271,6 +303,13 @@ public:
     //	return this->param.c_str();
     //}
 
+    const char* GetValue(const CTagObject* parent, const CTagObject* parHolder, ParamNoValueStorage_t& storage) const
+    {
+        BEHAVIAC_UNUSED_VAR(storage);
+
+        return this->GetValue(parent, parHolder);
+    }
+
     void SetValue(const char* v)
     {
         this->bDefaultValid = true;
@@ -331,6 +370,13 @@ public:
     //	return this->param.c_str();
     //}
 
+    const char* GetValue(const CTagObject* parent, const CTagObject* parHolder, ParamNoValueStorage_t& storage) const
+    {
+        BEHAVIAC_UNUSED_VAR(storage);
+
+        return this->GetValue(parent, parHolder);
+    }
+
     void SetValue(const char* v)
     {
         this->bDefaultValid = true;
@@ -381,6 +427,13 @@ public:
     typedef const IList& GetReturnType;
     virtual const IList& GetValue() const;
     virtual const IList& GetValue(const CTagObject* parent, const CTagObject* parHolder) const;
+
+    const IList& GetValue(const CTagObject* parent, const CTagObject* parHolder, ParamNoValueStorage_t& storage) const
+    {
+        BEHAVIAC_UNUSED_VAR(storage);
+
+        return this->GetValue(parent, parHolder);
+    }
     void SetVariableRegistry(const CTagObject* parHolder, const IList& value)
     {
         BEHAVIAC_UNUSED_VAR(parHolder);
@@ -396,6 +449,13 @@ public:
     typedef const System::Object& GetReturnType;
     virtual const System::Object& GetValue() const;
     virtual const System::Object& GetValue(const CTagObject* parent, const CTagObject* parHolder) const;
+
+    const System::Object& GetValue(const CTagObject* parent, const CTagObject* parHolder, ParamNoValueStorage_t& storage) const
+    {
+        BEHAVIAC_UNUSED_VAR(storage);
+
+        return this->GetValue(parent, parHolder);
+    }
     void SetVariableRegistry(const CTagObject* parHolder, const System::Object& value)
     {
         BEHAVIAC_UNUSED_VAR(parHolder);
@@ -441,6 +501,11 @@ template <typename T>
 class ParamVariableStruct : public ParamVariablePrimitive<T>
 {
 public:
+    /**
+    the members bound to properties are assembled in a copy of the literal fields, kept by the caller
+    */
+    typedef T ValueStorage_t;
+
     ParamVariableStruct()
     {}
 
@@ -483,6 +548,8 @@ public:
                     {
                         BEHAVIAC_LOG1(BEHAVIAC_LOG_WARNING, "Fail read param count from behaviac::string:%s\n", str);
                     }
+
+                    this->ResolveMembers();
                 }
             }
         }
@@ -493,28 +560,63 @@ public:
         return this->param;
     }
 
-    const T& GetValue(const CTagObject* parent, const CTagObject* parHolder) const;
+    /**
+    return the struct bound to a property, or the literal fields with the members bound to properties
+    assembled in 'storage', which is valid as long as 'storage' is.
+    */
+    const T& GetValue(const CTagObject* parent, const CTagObject* parHolder, T& storage) const;
+
+    const T& GetValue(const CTagObject* parent, const CTagObject* parHolder, ParamOutValueStorage_t<T>& storage) const
+    {
+        const T& value = this->GetValue(parent, parHolder, storage.value);
+
+        if (&value == &this->param)
+        {
+            storage.value = this->param;
+
+            return storage.value;
+        }
+
+        return value;
+    }
 
     void operator=(const ParamVariableStruct& copy)
     {
         ParamVariablePrimitive<T>* pBase = (ParamVariablePrimitive<T>*)this;
         *pBase = *(ParamVariablePrimitive<T>*)&copy;
 
-        for (PropsMap_t::iterator it = this->m_props.begin();
-             it != this->m_props.end(); ++it)
+        for (typename PropsMap_t::const_iterator it = copy.m_props.begin();
+             it != copy.m_props.end(); ++it)
         {
             const CStringID& propId = it->first;
             behaviac::Property* p = it->second;
 
             this->m_props[propId] = p->clone();
         }
+
+        this->ResolveMembers();
     }
 
     void SetVariableRegistry(const CTagObject* parHolder, const T& value);
 
 private:
+    /**
+    the literal fields are already in 'param' after loading, only the fields bound to a property
+    are kept here with their member resolved, so that the tick doesn't look the member up by name
+    */
+    void ResolveMembers();
+
     typedef behaviac::map<CStringID, behaviac::Property*> PropsMap_t;
     PropsMap_t		m_props;
+
+    struct BoundMember_t
+    {
+        const CMemberBase*		member;
+        behaviac::Property*		prop;
+    };
+
+    typedef behaviac::vector<BoundMember_t> BoundMembers_t;
+    BoundMembers_t	m_members;
 };
 
 template <typename T, bool bIsPtr>
@@ -578,6 +680,36 @@ struct ParamVariable : public ParamVariableSelector<T, behaviac::Meta::HasFromSt
     virtual ~ParamVariable() {};
 };
 
+/**
+the storage of an argument of 'ParamType' kept in a ParamVariable<StoredType>, the tree is only read by the call
+*/
+template <typename ParamType, typename StoredType>
+struct ParamValueStorageSelector
+{
+    typedef typename behaviac::Meta::IfThenElse < behaviac::Meta::IsRef<ParamType>::Result && !behaviac::Meta::IsConst<ParamType>::Result,
+            ParamOutValueStorage_t<StoredType>, typename ParamVariable<StoredType>::ValueStorage_t >::Result ValueStorage_t;
+};
+
+//a string argument is returned as a pointer, which is already a copy of the caller
+template <typename ParamType>
+struct ParamValueStorageSelector<ParamType, char*>
+{
+    typedef ParamNoValueStorage_t ValueStorage_t;
+};
+
+//a list or an object argument is always read from a property
+template <typename ParamType>
+struct ParamValueStorageSelector<ParamType, IList>
+{
+    typedef ParamNoValueStorage_t ValueStorage_t;
+};
+
+template <typename ParamType>
+struct ParamValueStorageSelector<ParamType, System::Object>
+{
+    typedef ParamNoValueStorage_t ValueStorage_t;
+};
+
 class IMethodReturn
 {
 public:
@@ -1065,13 +1197,13 @@ public:
     const static short KMETHOD_NAMEDEVENT = 0x0001;
 
     CMethodBase(const char* propertyName, const char* classFullName) : m_classFullName(classFullName), m_propertyName(propertyName),
-        m_propertyID(propertyName), m_checkReturnTask(0), m_return(0), m_bStatic(false), m_flag(0), m_netRole(behaviac::NET_ROLE_DEFAULT)
+        m_propertyID(propertyName), m_checkReturnTask(0), m_return(0), m_returnTypeId(0), m_bStatic(false), m_flag(0), m_netRole(behaviac::NET_ROLE_DEFAULT)
     {
         BEHAVIAC_ASSERT(m_classFullName);
     }
     CMethodBase(const CMethodBase& copy) : m_classFullName(copy.m_classFullName), m_instanceName(copy.m_instanceName),
         m_propertyName(copy.m_propertyName), m_propertyID(copy.m_propertyID), m_displayName(copy.m_displayName), m_desc(copy.m_desc),
-        m_bStatic(copy.m_bStatic), m_flag(copy.m_flag), m_netRole(copy.m_netRole)
+        m_returnTypeId(copy.m_returnTypeId), m_bStatic(copy.m_bStatic), m_flag(copy.m_flag), m_netRole(copy.m_netRole)
     {
         if (copy.m_checkReturnTask)
         {
@@ -1190,6 +1322,7 @@ public:
 
         typedef behaviac::AsyncValue<R> ReturnType;
         this->m_return = BEHAVIAC_NEW ReturnType();
+        this->m_returnTypeId = GetClassTypeNumberId<typename ReturnType::ValueType>();
         return *this;
     }
 
@@ -1205,6 +1338,7 @@ public:
 
         typedef behaviac::AsyncValue<R> ReturnType;
         this->m_return = BEHAVIAC_NEW ReturnType();
+        this->m_returnTypeId = GetClassTypeNumberId<typename ReturnType::ValueType>();
         return *this;
     }
 
@@ -1221,6 +1355,7 @@ public:
 
         typedef behaviac::AsyncValue<R> ReturnType;
         this->m_return = BEHAVIAC_NEW ReturnType();
+        this->m_returnTypeId = GetClassTypeNumberId<typename ReturnType::ValueType>();
         return *this;
     }
 
@@ -1236,6 +1371,7 @@ public:
 
         typedef behaviac::AsyncValue<R> ReturnType;
         this->m_return = BEHAVIAC_NEW ReturnType();
+        this->m_returnTypeId = GetClassTypeNumberId<typename ReturnType::ValueType>();
         return *this;
     }
 
@@ -1244,6 +1380,7 @@ public:
     {
         typedef behaviac::AsyncValue<R> ReturnType;
         this->m_return = BEHAVIAC_NEW ReturnType();
+        this->m_returnTypeId = GetClassTypeNumberId<typename ReturnType::ValueType>();
         return *this;
     }
 
@@ -1325,13 +1462,18 @@ public:
     }
 
     int CheckReturn(const CTagObject* parent, const CTagObject* parentCheckResult, CMethodBase* checkResultMethod)
+    {
+        return this->CheckReturn(parent, this->m_return, parentCheckResult, checkResultMethod);
+    }
+
+    int CheckReturn(const CTagObject* parent, behaviac::IAsyncValue* pReturn, const CTagObject* parentCheckResult, CMethodBase* checkResultMethod)
     {
         BEHAVIAC_UNUSED_VAR(parent);
 
         if (checkResultMethod)
         {
-            BEHAVIAC_ASSERT(this->m_return);
-            int result = checkResultMethod->vRun(parentCheckResult, *this->m_return);
+            BEHAVIAC_ASSERT(pReturn);
+            int result = checkResultMethod->vRun(parentCheckResult, *pReturn);
 
             return result;
         }
@@ -1341,16 +1483,22 @@ public:
 
     template <typename RTYPE>
     void CheckReturn(const CTagObject* parent, RTYPE& result)
+    {
+        this->CheckReturn(parent, this->m_return, result);
+    }
+
+    template <typename RTYPE>
+    void CheckReturn(const CTagObject* parent, behaviac::IAsyncValue* pReturn, RTYPE& result)
     {
         if (this->m_checkReturnTask)
         {
-            BEHAVIAC_ASSERT(this->m_return);
-            this->m_checkReturnTask->run(result, parent, *this->m_return);
+            BEHAVIAC_ASSERT(pReturn);
+            this->m_checkReturnTask->run(result, parent, *pReturn);
 
         }
-        else if (this->m_return)
+        else if (pReturn)
         {
-            result = ((behaviac::AsyncValue<RTYPE>*)this->m_return)->get();
+            result = ((behaviac::AsyncValue<RTYPE>*)pReturn)->get();
 
         }
         else
@@ -1360,16 +1508,21 @@ public:
     }
 
     void CheckReturn(const CTagObject* parent, bool& result)
+    {
+        this->CheckReturn(parent, this->m_return, result);
+    }
+
+    void CheckReturn(const CTagObject* parent, behaviac::IAsyncValue* pReturn, bool& result)
     {
         if (this->m_checkReturnTask)
         {
-            BEHAVIAC_ASSERT(this->m_return);
-            this->m_checkReturnTask->run(result, parent, *this->m_return);
+            BEHAVIAC_ASSERT(pReturn);
+            this->m_checkReturnTask->run(result, parent, *pReturn);
 
         }
-        else if (this->m_return)
+        else if (pReturn)
         {
-            result = ((behaviac::AsyncValue<bool>*)this->m_return)->get();
+            result = ((behaviac::AsyncValue<bool>*)pReturn)->get();
 
         }
         else
@@ -1482,6 +1635,56 @@ public:
         this->run(pParent, pAgent);
     }
 
+    /**
+    run the method with its return value kept in a temporary instead of the method's own storage,
+    so that the value is not overwritten by another call of the method before it is read.
+
+    be careful to use this function only when you know the return type.
+    return false if the method has no return value.
+    */
+    template <typename R>
+    bool Invoke(const CTagObject* pParent, const CTagObject* pAgent, R& returnValue)
+    {
+        if (this->IsReturnType<R>())
+        {
+            this->Call(pParent, pAgent, &returnValue);
+
+            return true;
+        }
+
+        behaviac::IAsyncValue* pReturn = this->CreateReturnValue();
+
+        this->run(pParent, pAgent, pReturn);
+
+        if (pReturn)
+        {
+            returnValue = ((behaviac::AsyncValue<R>*)pReturn)->get();
+            BEHAVIAC_DELETE(pReturn);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+    return true if the method returns 'R', then the result can be written to a 'R' directly by 'Call'.
+    */
+    template <typename R>
+    bool IsReturnType() const
+    {
+        return this->m_return && this->m_returnTypeId == GetClassTypeNumberId<R>();
+    }
+
+    /**
+    create the storage for the return value, it is owned by the caller and to be passed to 'run'.
+    return 0 if the method has no return value.
+    */
+    behaviac::IAsyncValue* CreateReturnValue() const
+    {
+        return this->m_return ? this->m_return->create() : 0;
+    }
+
     //public void Invoke(Agent pSelf, void* param)
     //{
     //	BEHAVIAC_ASSERT(0);
@@ -1539,6 +1742,14 @@ public:
         this->m_instanceName = name;
     }
 
+    /**
+    return true if it is a method of the agent itself, otherwise its agent is looked up by the instance name
+    */
+    bool IsSelf() const
+    {
+        return this->m_instanceName.empty() || this->m_instanceName == "Self";
+    }
+
     virtual bool IsNamedEvent() const
     {
         return false;
@@ -1549,7 +1760,32 @@ public:
         return this->m_bStatic;
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder) = 0;
+    bool HasCheckReturn() const
+    {
+        return this->m_checkReturnTask != 0;
+    }
+
+    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    {
+        this->run(parent, parHolder, this->m_return);
+    }
+
+    /**
+    run the method and keep the return value in 'pReturn', which is created by 'CreateReturnValue'.
+    neither the method's own return storage nor its params are written, the struct arguments are assembled in
+    the caller's locals, so the method can be run by several callers at the same time.
+    */
+    void run(const CTagObject* parent, const CTagObject* parHolder, behaviac::IAsyncValue* pReturn)
+    {
+        this->Call(parent, parHolder, pReturn ? pReturn->GetValueAddress() : 0);
+    }
+
+    /**
+    run the method and write the return value to 'pResult' directly if it is not 0.
+    it is implemented by each registered method type with its return type and params known,
+    'pResult' should point to a value of the return type, see 'IsReturnType'.
+    */
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult) = 0;
 
 protected:
 
@@ -1575,6 +1811,7 @@ protected:
 
     CCheckReturn*					m_checkReturnTask;
     behaviac::IAsyncValue*			m_return;
+    int								m_returnTypeId;
 
     //ParentType						m_parentType;
 
@@ -1836,10 +2073,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod_R(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -1870,9 +2108,9 @@ public:
         {
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)();
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -1943,10 +2181,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -2273,10 +2512,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod1_R(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -2298,7 +2538,8 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                const ParamBaseType& v = this->m_param.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType, StoredType>::ValueStorage_t s;
+                const ParamBaseType& v = this->m_param.GetValue(parent, parHolder, s);
                 bHandled = pNw->SendRemoteEvent<ParamType>(CGenericMethod1_<R, ObjectType, ParamType>::m_netRole, nameTemp.c_str(),
                                                            (PARAM_CALLEDTYPE(ParamType))v);
             }
@@ -2307,15 +2548,16 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType>::GetReturnType v = this->m_param.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType, StoredType>::ValueStorage_t s;
+            typename ParamVariable<StoredType>::GetReturnType v = this->m_param.GetValue(parent, parHolder, s);
 
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)((PARAM_CALLEDTYPE(ParamType))v);
 
             CGenericMethod1_<R, ObjectType, ParamType>::m_param.SetVariableRegistry(parent, v);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -2394,10 +2636,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod1(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -2419,7 +2662,8 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                const ParamBaseType& v = this->m_param.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType, StoredType>::ValueStorage_t s;
+                const ParamBaseType& v = this->m_param.GetValue(parent, parHolder, s);
 
                 bHandled = pNw->SendRemoteEvent<ParamType>(this->m_netRole, nameTemp.c_str(),
                                                            (PARAM_CALLEDTYPE(ParamType))v);
@@ -2429,7 +2673,8 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType>::GetReturnType v = this->m_param.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType, StoredType>::ValueStorage_t s;
+            typename ParamVariable<StoredType>::GetReturnType v = this->m_param.GetValue(parent, parHolder, s);
             (((ObjectType*)parent)->*this->m_methodPtr)((PARAM_CALLEDTYPE(ParamType))v);
 
             this->m_param.SetVariableRegistry(parent, v);
@@ -2758,10 +3003,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod2_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -2783,8 +3029,10 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2>(this->m_netRole, nameTemp.c_str(),
                                                                         (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2795,8 +3043,10 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2876,10 +3126,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod2(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -2901,8 +3152,10 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2>(this->m_netRole, nameTemp.c_str(),
                                                                         (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2913,8 +3166,10 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2923,9 +3178,9 @@ public:
             this->m_param1.SetVariableRegistry(parent, v1);
             this->m_param2.SetVariableRegistry(parent, v2);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -2984,10 +3239,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod2(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -3009,8 +3265,10 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2>(this->m_netRole, nameTemp.c_str(),
                                                                         (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3021,8 +3279,10 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3407,10 +3667,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod3_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -3432,9 +3693,12 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3>(this->m_netRole, nameTemp.c_str(),
                                                                                     (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3446,9 +3710,12 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3544,10 +3811,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod3(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -3569,9 +3837,12 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3>(this->m_netRole, nameTemp.c_str(),
                                                                                     (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3583,9 +3854,12 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3596,9 +3870,9 @@ public:
             this->m_param2.SetVariableRegistry(parHolder, v2);
             this->m_param3.SetVariableRegistry(parHolder, v3);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -3662,10 +3936,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod3(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -3687,9 +3962,12 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3>(this->m_netRole, nameTemp.c_str(),
                                                                                     (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3701,9 +3979,12 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4168,10 +4449,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod4_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -4193,10 +4475,14 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4>(this->m_netRole, nameTemp.c_str(),
                                                                                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4209,10 +4495,14 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4318,10 +4608,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod4(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -4343,10 +4634,14 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4>(this->m_netRole, nameTemp.c_str(),
                                                                                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4359,10 +4654,14 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4370,9 +4669,9 @@ public:
                                 (PARAM_CALLEDTYPE(ParamType3))v3,
                                 (PARAM_CALLEDTYPE(ParamType4))v4);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
 
             this->m_param1.SetVariableRegistry(parHolder, v1);
@@ -4444,10 +4743,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod4(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -4469,10 +4769,14 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4>(this->m_netRole, nameTemp.c_str(),
                                                                                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4485,10 +4789,14 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5024,10 +5332,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod5_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -5049,11 +5358,16 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5067,11 +5381,16 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5189,10 +5508,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod5(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -5214,11 +5534,16 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5232,11 +5557,16 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5245,9 +5575,9 @@ public:
                                 (PARAM_CALLEDTYPE(ParamType4))v4,
                                 (PARAM_CALLEDTYPE(ParamType5))v5);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
 
             this->m_param1.SetVariableRegistry(parHolder, v1);
@@ -5326,10 +5656,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod5(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -5351,11 +5682,16 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5369,11 +5705,16 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5982,10 +6323,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod6_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -6007,12 +6349,18 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6027,12 +6375,18 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6162,10 +6516,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod6(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -6187,12 +6542,18 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6207,12 +6568,18 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6222,9 +6589,9 @@ public:
                                 (PARAM_CALLEDTYPE(ParamType5))v5,
                                 (PARAM_CALLEDTYPE(ParamType6))v6);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
 
             this->m_param1.SetVariableRegistry(parHolder, v1);
@@ -6309,10 +6676,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod6(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -6334,12 +6702,18 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6354,12 +6728,18 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -7041,10 +7421,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod7_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -7066,13 +7447,20 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -7088,13 +7476,20 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -7236,10 +7631,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod7(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -7261,13 +7657,20 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -7283,13 +7686,20 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -7300,9 +7710,9 @@ public:
                                 (PARAM_CALLEDTYPE(ParamType6))v6,
                                 (PARAM_CALLEDTYPE(ParamType7))v7);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
 
             this->m_param1.SetVariableRegistry(parHolder, v1);
@@ -7394,10 +7804,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod7(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -7419,13 +7830,20 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -7441,13 +7859,20 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -8202,10 +8627,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod8_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -8227,14 +8653,22 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+                typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7, ParamType8>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -8251,14 +8685,22 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+            typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -8412,10 +8854,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod8(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -8437,14 +8880,22 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+                typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7, ParamType8>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -8461,14 +8912,22 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+            typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
             R returnValue = (((ObjectType*)parent)->*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -8480,9 +8939,9 @@ public:
                                 (PARAM_CALLEDTYPE(ParamType7))v7,
                                 (PARAM_CALLEDTYPE(ParamType8))v8);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
 
             this->m_param1.SetVariableRegistry(parHolder, v1);
@@ -8579,10 +9038,11 @@ public:
         return BEHAVIAC_NEW CGenericMethod8(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -8604,14 +9064,22 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+                typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
                 bHandled = pNw->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7, ParamType8>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -8628,14 +9096,22 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+            typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
             (((ObjectType*)parent)->*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -138,10 +138,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic_R(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
@@ -175,9 +176,9 @@ public:
         {
             R returnValue = (*this->m_methodPtr)();
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -224,10 +225,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
@@ -471,6 +473,7 @@ class CGenericMethodStatic1_R : public CGenericMethodStatic1_<R, ParamType>
 {
 public:
     typedef typename CGenericMethodStatic1_<R, ParamType>::ParamBaseType ParamBaseType;
+    typedef typename CGenericMethodStatic1_<R, ParamType>::StoredType StoredType;
 
     CGenericMethodStatic1_R(R(*methodPtr)(ParamType), const char* className, const char* propertyName) :
         CGenericMethodStatic1_<R, ParamType>(methodPtr, className, propertyName)
@@ -488,10 +491,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic1_R(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -513,7 +517,8 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                const ParamBaseType& v = this->m_param.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType, StoredType>::ValueStorage_t s;
+                const ParamBaseType& v = this->m_param.GetValue(parent, parHolder, s);
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType>(this->m_netRole, nameTemp.c_str(),
                                                                                         (PARAM_CALLEDTYPE(ParamType))v);
             }
@@ -522,15 +527,16 @@ public:
         if (!bHandled)
 #endif//BEHAVIAC_ENABLE_NETWORKD
         {
-            const ParamBaseType& v = this->m_param.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType, StoredType>::ValueStorage_t s;
+            const ParamBaseType& v = this->m_param.GetValue(parent, parHolder, s);
 
             R returnValue = (*this->m_methodPtr)((PARAM_CALLEDTYPE(ParamType))v);
 
             this->m_param.SetVariableRegistry(parHolder, v);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -574,6 +580,7 @@ class CGenericMethodStatic1<void, ParamType> : public CGenericMethodStatic1_<voi
 {
 public:
     typedef typename CGenericMethodStatic1_<void, ParamType>::ParamBaseType ParamBaseType;
+    typedef typename CGenericMethodStatic1_<void, ParamType>::StoredType StoredType;
 
     CGenericMethodStatic1(void(*methodPtr)(ParamType), const char* className, const char* propertyName) :
         CGenericMethodStatic1_<void, ParamType>(methodPtr, className, propertyName)
@@ -584,10 +591,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic1(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -609,7 +617,8 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                const ParamBaseType& v = this->m_param.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType, StoredType>::ValueStorage_t s;
+                const ParamBaseType& v = this->m_param.GetValue(parent, parHolder, s);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType>(this->m_netRole, nameTemp.c_str(),
                                                                                         (PARAM_CALLEDTYPE(ParamType))v);
@@ -619,7 +628,8 @@ public:
         if (!bHandled)
 #endif//BEHAVIAC_ENABLE_NETWORKD
         {
-            const ParamBaseType& v = this->m_param.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType, StoredType>::ValueStorage_t s;
+            const ParamBaseType& v = this->m_param.GetValue(parent, parHolder, s);
 
             (*this->m_methodPtr)((PARAM_CALLEDTYPE(ParamType))v);
 
@@ -923,10 +933,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic2_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -948,8 +959,10 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -960,8 +973,10 @@ public:
         if (!bHandled)
 #endif//BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1032,10 +1047,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic2(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -1057,8 +1073,10 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1069,8 +1087,10 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
             R returnValue = (*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1079,9 +1099,9 @@ public:
             this->m_param1.SetVariableRegistry(parHolder, v1);
             this->m_param2.SetVariableRegistry(parHolder, v2);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -1129,10 +1149,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic2(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -1154,8 +1175,10 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1166,8 +1189,10 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1545,10 +1570,11 @@ class CGenericMethodStatic3_ : public CMethodBase
         return BEHAVIAC_NEW CGenericMethodStatic3_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -1570,9 +1596,12 @@ class CGenericMethodStatic3_ : public CMethodBase
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1584,9 +1613,12 @@ class CGenericMethodStatic3_ : public CMethodBase
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1669,10 +1701,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic3(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -1694,9 +1727,12 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1708,9 +1744,12 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
             R returnValue = (*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1721,9 +1760,9 @@ public:
             this->m_param2.SetVariableRegistry(parHolder, v2);
             this->m_param3.SetVariableRegistry(parHolder, v3);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -1776,10 +1815,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic3(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -1801,9 +1841,12 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -1815,9 +1858,12 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2266,10 +2312,11 @@ class CGenericMethodStatic4_ : public CMethodBase
         return BEHAVIAC_NEW CGenericMethodStatic4_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -2291,10 +2338,14 @@ class CGenericMethodStatic4_ : public CMethodBase
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2307,10 +2358,14 @@ class CGenericMethodStatic4_ : public CMethodBase
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2406,10 +2461,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic4(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -2431,10 +2487,14 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2447,10 +2507,14 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
             R returnValue = (*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2463,9 +2527,9 @@ public:
             this->m_param3.SetVariableRegistry(parHolder, v3);
             this->m_param4.SetVariableRegistry(parHolder, v4);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -2523,10 +2587,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic4(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -2548,10 +2613,14 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -2564,10 +2633,14 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
                 (PARAM_CALLEDTYPE(ParamType2))v2,
@@ -3121,10 +3194,11 @@ class CGenericMethodStatic5_ : public CMethodBase
         return BEHAVIAC_NEW CGenericMethodStatic5_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -3146,11 +3220,16 @@ class CGenericMethodStatic5_ : public CMethodBase
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3164,11 +3243,16 @@ class CGenericMethodStatic5_ : public CMethodBase
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3276,10 +3360,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic5(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -3301,11 +3386,16 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3319,11 +3409,16 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
             R returnValue = (*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3338,9 +3433,9 @@ public:
             this->m_param4.SetVariableRegistry(parHolder, v4);
             this->m_param5.SetVariableRegistry(parHolder, v5);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -3403,10 +3498,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic5(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -3428,11 +3524,16 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -3446,11 +3547,16 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4050,10 +4156,11 @@ class CGenericMethodStatic6_ : public CMethodBase
         return BEHAVIAC_NEW CGenericMethodStatic6_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -4075,12 +4182,18 @@ class CGenericMethodStatic6_ : public CMethodBase
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4095,12 +4208,18 @@ class CGenericMethodStatic6_ : public CMethodBase
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4220,10 +4339,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic6(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -4245,12 +4365,18 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4265,12 +4391,18 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
             R returnValue = (*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4287,9 +4419,9 @@ public:
             this->m_param5.SetVariableRegistry(parHolder, v5);
             this->m_param6.SetVariableRegistry(parHolder, v6);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -4357,10 +4489,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic6(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -4382,12 +4515,18 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -4402,12 +4541,18 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5080,10 +5225,11 @@ class CGenericMethodStatic7_ : public CMethodBase
         return BEHAVIAC_NEW CGenericMethodStatic7_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -5105,13 +5251,20 @@ class CGenericMethodStatic7_ : public CMethodBase
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5127,13 +5280,20 @@ class CGenericMethodStatic7_ : public CMethodBase
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5265,10 +5425,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic7(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -5290,13 +5451,20 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5312,13 +5480,20 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
             R returnValue = (*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5337,9 +5512,9 @@ public:
             this->m_param6.SetVariableRegistry(parHolder, v6);
             this->m_param7.SetVariableRegistry(parHolder, v7);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -5412,10 +5587,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic7(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -5437,13 +5613,20 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -5459,13 +5642,20 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6211,10 +6401,11 @@ class CGenericMethodStatic8_ : public CMethodBase
         return BEHAVIAC_NEW CGenericMethodStatic8_(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -6236,14 +6427,22 @@ class CGenericMethodStatic8_ : public CMethodBase
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+                typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7, ParamType8>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6260,14 +6459,22 @@ class CGenericMethodStatic8_ : public CMethodBase
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+            typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6411,10 +6618,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic8(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -6436,14 +6644,22 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+                typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7, ParamType8>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6460,14 +6676,22 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+            typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
             R returnValue = (*this->m_methodPtr)(
                                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6488,9 +6712,9 @@ public:
             this->m_param7.SetVariableRegistry(parHolder, v7);
             this->m_param8.SetVariableRegistry(parHolder, v8);
 
-            if (this->m_return)
+            if (pResult)
             {
-                *(behaviac::AsyncValue<R>*)this->m_return = returnValue;
+                *(typename behaviac::AsyncValue<R>::ValueType*)pResult = returnValue;
             }
         }
     }
@@ -6568,10 +6792,11 @@ public:
         return BEHAVIAC_NEW CGenericMethodStatic8(*this);
     }
 
-    virtual void run(const CTagObject* parent, const CTagObject* parHolder)
+    virtual void Call(const CTagObject* parent, const CTagObject* parHolder, void* pResult)
     {
         BEHAVIAC_UNUSED_VAR(parent);
         BEHAVIAC_UNUSED_VAR(parHolder);
+        BEHAVIAC_UNUSED_VAR(pResult);
 #if BEHAVIAC_ENABLE_NETWORKD
         bool bHandled = false;
 
@@ -6593,14 +6818,22 @@ public:
                     nameTemp = this->m_propertyName;
                 }
 
-                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+                typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+                typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+                typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+                typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+                typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+                typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+                typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+                typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+                typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+                typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+                typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+                typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+                typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+                typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+                typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+                typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
                 bHandled = behaviac::Network::GetInstance()->SendRemoteEvent<ParamType1, ParamType2, ParamType3, ParamType4, ParamType5, ParamType6, ParamType7, ParamType8>(this->m_netRole, nameTemp.c_str(),
                            (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -6617,14 +6850,22 @@ public:
         if (!bHandled)
 #endif//#if BEHAVIAC_ENABLE_NETWORKD
         {
-            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder);
-            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder);
+            typename ParamValueStorageSelector<ParamType1, StoredType1>::ValueStorage_t s1;
+            typename ParamVariable<StoredType1>::GetReturnType v1 = this->m_param1.GetValue(parent, parHolder, s1);
+            typename ParamValueStorageSelector<ParamType2, StoredType2>::ValueStorage_t s2;
+            typename ParamVariable<StoredType2>::GetReturnType v2 = this->m_param2.GetValue(parent, parHolder, s2);
+            typename ParamValueStorageSelector<ParamType3, StoredType3>::ValueStorage_t s3;
+            typename ParamVariable<StoredType3>::GetReturnType v3 = this->m_param3.GetValue(parent, parHolder, s3);
+            typename ParamValueStorageSelector<ParamType4, StoredType4>::ValueStorage_t s4;
+            typename ParamVariable<StoredType4>::GetReturnType v4 = this->m_param4.GetValue(parent, parHolder, s4);
+            typename ParamValueStorageSelector<ParamType5, StoredType5>::ValueStorage_t s5;
+            typename ParamVariable<StoredType5>::GetReturnType v5 = this->m_param5.GetValue(parent, parHolder, s5);
+            typename ParamValueStorageSelector<ParamType6, StoredType6>::ValueStorage_t s6;
+            typename ParamVariable<StoredType6>::GetReturnType v6 = this->m_param6.GetValue(parent, parHolder, s6);
+            typename ParamValueStorageSelector<ParamType7, StoredType7>::ValueStorage_t s7;
+            typename ParamVariable<StoredType7>::GetReturnType v7 = this->m_param7.GetValue(parent, parHolder, s7);
+            typename ParamValueStorageSelector<ParamType8, StoredType8>::ValueStorage_t s8;
+            typename ParamVariable<StoredType8>::GetReturnType v8 = this->m_param8.GetValue(parent, parHolder, s8);
 
             (*this->m_methodPtr)(
                 (PARAM_CALLEDTYPE(ParamType1))v1,
@@ -102,7 +102,12 @@ namespace behaviac
 
     class BehaviorTree;
     class BehaviorNode;
+    class BehaviorTask;
     class BehaviorTreeTask;
+    class Property;
+    struct PreloadItem_t;
+    struct PreloadContext_t;
+    struct AsyncLoad_t;
     class Agent;
 
     class BEHAVIAC_API Workspace
@@ -149,6 +154,24 @@ namespace behaviac
         EFileFormat GetFileFormat();
         void SetFileFormat(EFileFormat ff);
 
+        /**
+        if enabled, the bson files are memory mapped and parsed in place instead of being read into the file buffer.
+        the tree keeps the mapping until it is unloaded or reloaded, the class names and agent types of its nodes point into it
+        instead of being copied. the other node properties are still copied. when subtree sharing is enabled or the file
+        is compressed the mapping is released right after parsing, as the shared nodes outlive the tree.
+        it falls back to reading the file when CFileManager::FileMap fails. it is disabled by default.
+        */
+        bool IsFileMapping() const;
+        void SetFileMapping(bool bFileMapping);
+
+        /**
+        if enabled, the identical subtrees of the xml and bson behavior trees are shared within and across the trees when they are loaded.
+        the tasks still use the ids of the nodes in their own trees, so the debugger sees the ids of the designer.
+        the fsm trees and the trees having htn tasks or methods are not shared. it is disabled by default.
+        */
+        bool IsSubtreeSharing() const;
+        void SetSubtreeSharing(bool bSubtreeSharing);
+
         bool IsExecAgents() const;
         void SetIsExecAgents(bool bExecAgents);
 
@@ -162,6 +185,13 @@ namespace behaviac
 
         void BehaviorNodeLoaded(const char* nodeType, const properties_t& properties);
 
+        /**
+        the local added while a worker of HotReloadAsync builds a tree, it is added to AgentProperties when the tree is swapped in.
+
+        @return 0 if the calling thread is not building a tree
+        */
+        Property* DeferLocal(const char* agentType, const char* typeName, const char* variableName, const char* valueStr);
+
         bool ExportMetas(const char* xmlMetaFilePath);
         void Cleanup();
 
@@ -189,13 +219,97 @@ namespace behaviac
 
         BehaviorTree* LoadBehaviorTree(const char* relativePath);
 
-        int UpdateActionCount(const char* actionString);
-        int GetActionCount(const char* actionString);
+        /**
+        preload the behavior trees of 'relativePaths', or all the exported ones of the current file format in PreloadAll.
+
+        the files are read, and the xml files are parsed, on 'threadCount' threads including the calling thread.
+        with the combined formats, EFF_default, each tree is read in the format Load picks for it, the cpp ones are created afterwards.
+        the behavior trees are then created on the calling thread, which resolves the referenced behavior trees as well.
+        if CFileManager is overridden, its FileOpen needs to be thread safe.
+
+        @return the number of the behavior trees loaded
+        */
+        uint32_t Preload(const behaviac::vector<behaviac::string>& relativePaths, uint32_t threadCount);
+        uint32_t PreloadAll(uint32_t threadCount);
+
+        /**
+        read, and parse for xml, the files of 'relativePaths' on a worker thread and return right away.
+
+        the behavior trees are created on the calling thread in Update, or in FinishAsyncLoads,
+        after their files are ready. the ones loaded in the meantime are skipped.
+        */
+        void LoadAsync(const behaviac::vector<behaviac::string>& relativePaths);
+
+        /**
+        create the behavior trees of the finished LoadAsync requests, and hot reload the ones of the finished HotReloadAsync requests.
+        if bWait is true, it waits for all the pending requests.
+
+        @return the number of the behavior trees loaded or reloaded
+        */
+        uint32_t FinishAsyncLoads(bool bWait);
+
+        /**
+        keep the resident behavior trees within 'budgetBytes', 0 for no limit, which is the default.
+
+        when the budget is exceeded, the least recently used behavior trees are unloaded in Update, or in EnforceMemoryBudget,
+        except the ones used by the live tasks created by CreateBehaviorTreeTask and the ones referenced by other resident trees.
+        the resident bytes of a behavior tree are the bytes allocated by the loading thread while loading it, see GetThreadAllocatedSize,
+        so the allocations of the other threads are not counted. if the default allocator is not used or doesn't track its allocated size,
+        they are estimated by its nodes.
+        */
+        void SetMemoryBudget(uint32_t budgetBytes);
+        uint32_t GetMemoryBudget() const;
+
+        /**
+        @return the number of the behavior trees unloaded
+        */
+        uint32_t EnforceMemoryBudget();
+
+        uint32_t GetResidentBytes() const;
+        uint32_t GetResidentBytes(const char* relativePath) const;
+
+        /**
+        pack the exported behavior trees of the current file format into a single archive file,
+        which has a header, an index hashed by the relative paths, a string table of the paths and the payloads of the trees.
+        for EFF_default, both the xml and the bson files are packed, the xml one is used if a tree has both.
+        if bCompressBson is true, the bson payloads are packed in the compressed container of CompressFile.
+
+        @return false if there is no behavior tree to pack or the archive can't be written
+        */
+        bool ExportArchive(const char* archivePath, bool bCompressBson = false);
+
+        /**
+        write 'path' into 'compressedPath' in the block compressed container.
+
+        the compressed files, mostly the exported .bson.bytes ones, are detected by their header when they are loaded
+        and are decompressed block by block while they are being read.
+        */
+        bool CompressFile(const char* path, const char* compressedPath);
+
+        /**
+        read the archive exported by ExportArchive into the memory.
+
+        Load then looks up the behavior trees in the archive's index and loads them without any further file system call,
+        the behavior trees not in the archive are still loaded from their own files,
+        as well as the ones archived in a file format other than the current one.
+
+        @return false if the archive can't be read or any of its offsets or sizes is out of the range
+        */
+        bool LoadArchive(const char* archivePath);
+        void UnLoadArchive();
+        bool IsArchived(const char* relativePath) const;
+
+        /**
+        the action counts are kept by the context of 'pAgent', see Context::UpdateActionCount
+        */
+        int UpdateActionCount(const behaviac::Agent* pAgent, const char* actionString);
+        int GetActionCount(const behaviac::Agent* pAgent, const char* actionString);
 
         /**
         check if it is set as a break point
         */
         bool CheckBreakpoint(const behaviac::Agent* pAgent, const behaviac::BehaviorNode* b, const char* action, behaviac::EActionResult actionResult);
+        bool CheckBreakpoint(const behaviac::Agent* pAgent, const behaviac::BehaviorTask* b, const char* action, behaviac::EActionResult actionResult);
 
         /**
         check if 'filter' is set to break
@@ -222,14 +336,71 @@ namespace behaviac
         void SetAutoHotReload(bool enable);
         bool GetAutoHotReload();
         void HotReload();
+
+        /**
+        reload 'relativePath' in place for the tasks using it.
+
+        the reloaded nodes are diffed with the previous ones by their ids, the tasks of the unchanged nodes keep
+        their state and only the changed subtrees are recreated. a changed running subtree under a Parallel or
+        a SelectorLoop is restarted alone, the tasks whose tree level node or any other running node is changed
+        are restarted as a whole.
+
+        @return false if it is not used by any task or fails to be loaded, the previous nodes are kept then.
+        */
+        bool HotReload(const char* relativePath);
+
+        /**
+        read the files of 'relativePaths' and build their new behavior trees on a worker thread and return right away.
+        the built trees are swapped into the loaded ones in the next Update, or in FinishAsyncLoads, which only loads
+        their referenced trees, shares their subtrees and rebinds the tasks like HotReload(relativePath).
+
+        the referenced trees are loaded and the new locals are added on the calling thread then, see DeferLocal.
+        if a BehaviorNodeLoader is set, the trees are only read and parsed on the worker, and they are reloaded by HotReload.
+
+        HotReload uses it for the modified files, so that the frame doesn't wait for the files.
+        */
+        void HotReloadAsync(const behaviac::vector<behaviac::string>& relativePaths);
         void RecordBTAgentMapping(const char* relativePath, Agent* agent);
 
         /**
         uses the behavior tree in the cache, if not loaded yet, it loads the behavior tree first
+
+        the loaded trees are a library shared by the contexts, the tasks only read the nodes, the arguments of the methods
+        are evaluated into the caller's storage and the executing node is kept per thread. each context is an instance
+        with its own agents, clock and breakpoint hit counts, so the contexts can be executed on separate threads,
+        creating and destroying their tasks concurrently.
+
+        the library is only changed by Load, UnLoad, HotReload and Update, which evicts the trees over the memory budget
+        and swaps in the trees built by HotReloadAsync, they have to be called when no context is being executed.
+        so the trees, including the referenced ones, are to be loaded before the contexts are executed on other threads.
+        @sa Context::SetTimeSinceStartup
         */
         BehaviorTreeTask* CreateBehaviorTreeTask(const char* relativePath);
         void DestroyBehaviorTreeTask(BehaviorTreeTask* behaviorTreeTask, Agent* agent);
 
+        struct BehaviorTreeTaskPoolStats_t
+        {
+            uint32_t hits;
+            uint32_t misses;
+            uint32_t discarded;
+            uint32_t pooled;
+            uint32_t highWaterMark;
+
+            BehaviorTreeTaskPoolStats_t() : hits(0), misses(0), discarded(0), pooled(0), highWaterMark(0)
+            {}
+        };
+
+        /**
+        keep up to 'highWaterMark' reset tasks of 'relativePath' for reuse instead of destroying them in DestroyBehaviorTreeTask.
+        'prewarmCount' tasks are created right away, the behavior tree is loaded if it is not loaded yet.
+
+        a pool is emptied whenever its behavior tree is reloaded or unloaded. highWaterMark 0 removes the pool.
+
+        @return false if the behavior tree can't be loaded
+        */
+        bool SetBehaviorTreeTaskPool(const char* relativePath, uint32_t prewarmCount, uint32_t highWaterMark);
+        bool GetBehaviorTreeTaskPoolStats(const char* relativePath, BehaviorTreeTaskPoolStats_t& stats) const;
+
         void RegisterBasicNodes();
         void UnRegisterBasicNodes();
 
@@ -295,9 +466,7 @@ namespace behaviac
         typedef behaviac::map<uint32_t, BreakpointInfo_t> BreakpointInfos_t;
         BreakpointInfos_t		m_breakpoints;
 
-        typedef behaviac::map<CStringID, int> ActionCount_t;
-        ActionCount_t			m_actions_count;
-
+        //guards the breakpoints, which are changed by HandleRequests and read by the threads executing the contexts
         behaviac::Mutex			m_cs;
         behaviac::wstring		m_workspaceExportPathAbs;
 
@@ -315,12 +484,105 @@ namespace behaviac
         bool					m_bExecAgents;
 
         Workspace::EFileFormat	m_fileFormat;
+        bool					m_bFileMapping;
+        bool					m_bSubtreeSharing;
 
         uint32_t				m_frame;
         behaviac::string		m_applogFilter;
 
         Workspace::BehaviorTrees_t m_behaviortrees;
 
+        //the files read by Preload, which are used by Load instead of reading the files again
+        typedef behaviac::map<behaviac::string, PreloadItem_t*> PreloadItems_t;
+        PreloadItems_t* m_preloadItems;
+
+        //the archive loaded by LoadArchive, 0 if there is none
+        char*					m_archive;
+        uint32_t				m_archiveSize;
+
+        //'format' is the file formats accepted, it is set to the one of the found behavior tree
+        const char* FindArchived(const char* relativePath, Workspace::EFileFormat& format, uint32_t& size) const;
+
+        //the bookkeeping of the memory budget, each loaded tree has an entry
+        struct ResidentTree_t
+        {
+            uint32_t							bytes;
+            //the number of the resident trees referencing it, it is not evicted before them
+            uint32_t							referencedBy;
+            uint32_t							lastUsed;
+            behaviac::vector<behaviac::string>	references;
+
+            ResidentTree_t() : bytes(0), referencedBy(0), lastUsed(0)
+            {}
+        };
+        typedef behaviac::map<behaviac::string, ResidentTree_t> ResidentTrees_t;
+        ResidentTrees_t			m_residentTrees;
+
+        //the number of the live tasks created by CreateBehaviorTreeTask of each tree,
+        //the trees are only compared as the destroyed tasks might outlive their trees
+        typedef behaviac::map<const BehaviorNode*, uint32_t> LiveTasks_t;
+        LiveTasks_t				m_liveTasks;
+
+        //guards the live tasks, the task pools and the hot reload records changed by CreateBehaviorTreeTask
+        //and DestroyBehaviorTreeTask from the threads executing the contexts
+        behaviac::Mutex			m_tasksCs;
+        uint32_t				m_residentBytes;
+        uint32_t				m_memoryBudget;
+        uint32_t				m_residentClock;
+
+        //the trees being loaded, the innermost one is the last
+        struct LoadingTree_t
+        {
+            behaviac::string					relativePath;
+            int64_t								allocatedSize;
+            uint32_t							nestedBytes;
+            uint32_t							builtBytes;
+            behaviac::vector<behaviac::string>	references;
+        };
+        behaviac::vector<LoadingTree_t> m_loadingTrees;
+
+        behaviac::vector<AsyncLoad_t*> m_asyncLoads;
+
+        void MakePreloadItems(const behaviac::vector<behaviac::string>& relativePaths, behaviac::vector<PreloadItem_t>& items, bool bReload);
+        uint32_t LoadPreloadItems(behaviac::vector<PreloadItem_t>& items, bool bReload);
+        bool SwapBuiltTree(PreloadItem_t& item);
+
+        static void BuildPreloadedTree(PreloadItem_t& item);
+        friend void PreloadItems(PreloadContext_t* ctx);
+        void StartAsyncLoad(const behaviac::vector<behaviac::string>& relativePaths, bool bReload);
+        void CancelAsyncLoads();
+
+        void BeginResidentTree(const char* relativePath);
+        void EndResidentTree(const char* relativePath, bool bLoaded);
+        void RemoveResidentTree(const char* relativePath);
+        void GetExportedFiles(const char* ext, behaviac::vector<behaviac::string>& relativePaths);
+
+        bool CheckBreakpoint(const behaviac::Agent* pAgent, const behaviac::string& bpStr, behaviac::EActionResult actionResult);
+
+        struct BehaviorTreeTaskPool_t
+        {
+            //the tree the pooled tasks are created from, 0 after the pool is freed
+            const BehaviorTree*					tree;
+            behaviac::vector<BehaviorTreeTask*>	tasks;
+            BehaviorTreeTaskPoolStats_t			stats;
+
+            BehaviorTreeTaskPool_t() : tree(0)
+            {}
+        };
+        typedef behaviac::map<behaviac::string, BehaviorTreeTaskPool_t> BehaviorTreeTaskPools_t;
+        BehaviorTreeTaskPools_t m_behaviorTreeTaskPools;
+
+        /**
+        destroy the pooled tasks of 'relativePath', or of all the pools if relativePath is 0.
+        the pool configuration and its stats are kept.
+        */
+        void FreeBehaviorTreeTaskPool(const char* relativePath);
+
+        /**
+        drop the loaded content of 'pBT' and its pooled tasks before it is reloaded from a new source.
+        */
+        void ClearForReloading(BehaviorTree* pBT, const char* relativePath);
+
 #if BEHAVIAC_ENABLE_HOTRELOAD
         typedef behaviac::vector<BehaviorTreeTask*> BehaviorTreeTasks_t;
 
@@ -331,6 +593,8 @@ namespace behaviac
         };
         typedef behaviac::map<behaviac::string, BTItem_t> AllBehaviorTreeTasks_t;
         AllBehaviorTreeTasks_t* m_allBehaviorTreeTasks;
+
+        void RebindBehaviorTreeTasks(BTItem_t& btItems, BehaviorTree* behaviorTree, BehaviorTree* previous);
 #endif//BEHAVIAC_ENABLE_HOTRELOAD
 
         BehaviorNodeLoader		m_pBehaviorNodeLoader;
@@ -77,6 +77,11 @@ namespace behaviac
 
         public:
             bool Execute(Agent* pAgent) const;
+
+            /**
+            the comparator if it is loaded as a comparison, otherwise 0
+            */
+            const VariableComparator* GetComparator() const;
         };
     protected:
         ActionConfig* m_ActionConfig;
@@ -84,6 +89,11 @@ namespace behaviac
 
     public:
         virtual bool Evaluate(Agent* pAgent);
+
+        const VariableComparator* GetComparator() const
+        {
+            return this->m_ActionConfig->GetComparator();
+        }
     protected:
         virtual BehaviorTask* createTask() const;
     };
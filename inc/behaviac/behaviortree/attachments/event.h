@@ -31,6 +31,7 @@ namespace behaviac
         virtual void load(int version, const char* agentType, const properties_t& properties);
 
         const char*		GetEventName();
+        const CStringID&	GetEventId();
         bool			TriggeredOnce();
         TriggerMode		GetTriggerMode();
         void			switchTo(Agent* pAgent);
@@ -42,6 +43,7 @@ namespace behaviac
 
     protected:
         CMethodBase*				m_event;
+        CStringID					m_eventId;
 
         behaviac::string			m_referencedBehaviorPath;
 
@@ -150,6 +150,49 @@ namespace behaviac
 #endif//USE_DOCUMENET
     };
 
+    /**
+    a string kept by a loaded node, it points into the file mapping kept by the tree being loaded if it is in it,
+    see Workspace::SetFileMapping, otherwise it is a copy.
+    */
+    class BEHAVIAC_API LoadedString
+    {
+    public:
+        LoadedString();
+        LoadedString(const LoadedString& copy);
+        ~LoadedString();
+
+        LoadedString& operator=(const LoadedString& other);
+
+        void Set(const char* str);
+        void swap(LoadedString& other);
+
+        const char* c_str() const
+        {
+            return this->m_str;
+        }
+
+        bool empty() const
+        {
+            return this->m_str[0] == '\0';
+        }
+
+        bool operator==(const LoadedString& other) const;
+        bool operator!=(const LoadedString& other) const
+        {
+            return !(*this == other);
+        }
+
+        /**
+        the strings in [pBegin, pBegin + size) are pointed to instead of being copied while the calling thread loads a tree,
+        it is cleared by passing 0
+        */
+        static void SetKeptRange(const char* pBegin, uint32_t size);
+
+    private:
+        const char*		m_str;
+        bool			m_bOwned;
+    };
+
     /**
     * Base class for BehaviorTree Nodes. This is the static part
     */
@@ -205,13 +248,36 @@ namespace behaviac
         uint32_t GetAttachmentsCount() const;
         const BehaviorNode* GetAttachment(uint32_t index) const;
 
+        /**
+        return 0 for a node shared by the subtrees of several trees, see Workspace::SetSubtreeSharing
+        */
         const BehaviorNode* GetParent() const
         {
             return this->m_parent;
         }
 
+        /**
+        return true if 'other' is loaded from the same content as this node, i.e. the same id, class,
+        properties, pars and attachments, and the children of the same ids.
+        the children themselves are not compared.
+        */
+        bool IsSameContent(const BehaviorNode* other) const;
+
+        /**
+        return false if this node can't be shared by the trees, i.e. its node or task uses its parent or the ids of other nodes.
+        @sa Workspace::SetSubtreeSharing
+        */
+        virtual bool IsSharable() const;
+
         void Clear();
-        bool CheckPreconditions(const Agent* pAgent, bool bIsAlive) const;
+        bool CheckPreconditions(const Agent* pAgent, bool bIsAlive) const
+        {
+            const PhasePreconditions_t& preconds = bIsAlive ? this->m_updatePreconds : this->m_enterPreconds;
+
+            //satisfied if there is no preconditions of this phase
+            return preconds.empty() || EvaluatePreconditions(pAgent, preconds);
+        }
+
         virtual void ApplyEffects(Agent* pAgent, BehaviorNode::EPhase phase) const;
         bool CheckEvents(const char* eventName, Agent* pAgent) const;
         virtual void Attach(BehaviorNode* pAttachment, bool bIsPrecondition, bool bIsEffector, bool bIsTransition);
@@ -223,6 +289,13 @@ namespace behaviac
             BEHAVIAC_ASSERT(false, "Only Condition/Sequence/And/Or allowed");
             return false;
         }
+
+        /**
+        add the ids of the variables read when the node is executed to 'variableIds'.
+        it returns false if its result depends on anything else, like a member or a method, or it has any side effect.
+        */
+        virtual bool GetReadVariables(behaviac::vector<uint32_t>& variableIds) const;
+
         //return true for Parallel, SelectorLoop, etc., which is responsible to update all its children just like sub trees
         //so that they are treated as a return-running node and the next update will continue them.
         virtual bool IsManagingChildrenAsSubTrees() const;
@@ -263,7 +336,7 @@ namespace behaviac
         virtual EBTStatus update_impl(Agent* pAgent, EBTStatus childStatus);
 
         void SetClassNameString(const char* className);
-        const behaviac::string& GetClassNameString() const;
+        const char* GetClassNameString() const;
 
         int GetId() const;
         void SetId(int id);
@@ -271,9 +344,41 @@ namespace behaviac
         void SetAgentType(const behaviac::string& agentType);
 
         void AddPar(const char* agentType, const char* type, const char* name, const char* value);
+        void CombineHash(uint32_t value);
+        void CombineHash(const char* str);
+        void CombineHash(const properties_t& properties);
+        void CombineHash(const BehaviorNode* pSubtree);
         bool EvaluteCustomCondition(const Agent* pAgent);
         void SetCustomCondition(BehaviorNode* node);
 
+        //true if it has no preconditions, effectors, events, custom condition, enter or exit action
+        bool IsPlain() const;
+
+        //GetReadVariables of all the children
+        bool GetChildrenReadVariables(behaviac::vector<uint32_t>& variableIds) const;
+
+        bool IsSharableSubtree() const;
+        bool IsSharableWith(const BehaviorNode* other) const;
+        bool IsSameLoadedContent(const BehaviorNode* other) const;
+        uint32_t GetSharingKey() const;
+
+        //the ids of this node, its attachments and its descendants in the order of BehaviorTask::collectids
+        void CollectIds(behaviac::vector<int>& ids) const;
+
+        /**
+        the ids of this node and its descendants in the order of BehaviorTask::collecttasks.
+        'nodeIds' are the ids collected by CollectIds to be used instead of the nodes' own ones, it might be empty,
+        'index' is the position of this node in it and it is advanced past the ids of the subtree.
+        */
+        void CollectTaskIds(const behaviac::vector<int>& nodeIds, uint32_t& index, behaviac::vector<int>& ids) const;
+
+        /**
+        replace the children by the shared nodes of the same content, the descendants are shared first.
+        the children without a shared node are registered to be shared by the trees loaded later.
+        return the number of the children replaced.
+        */
+        uint32_t ShareChildren();
+
     private:
         virtual BehaviorTask* createTask() const = 0;
 
@@ -292,18 +397,37 @@ namespace behaviac
         int PreconditionsCount() const;
     private:
         static CFactory<BehaviorNode>* ms_factory;
+
+        //the nodes which can be shared, indexed by GetSharingKey
+        typedef behaviac::map<uint32_t, BehaviorNode*> SharedNodes_t;
+        static SharedNodes_t* ms_sharedNodes;
+
         behaviac::vector<BehaviorNode*>		m_preconditions;
 
-        behaviac::string		m_className;
+        LoadedString			m_className;
         int						m_id;
-        behaviac::string		m_agentType;
-        char					m_enter_precond;
-        char					m_update_precond;
-        char					m_both_precond;
-        char					m_success_effectors;
-        char					m_failure_effectors;
-        char					m_both_effectors;
+        LoadedString			m_agentType;
         behaviac::vector<BehaviorNode*>		m_effectors;
+
+        /**
+        a precondition of a phase, 'bAnd' is how its result is combined with the results of the ones before it
+        */
+        struct PhasePrecondition_t
+        {
+            BehaviorNode*	precond;
+            bool			bAnd;
+        };
+
+        typedef behaviac::vector<PhasePrecondition_t> PhasePreconditions_t;
+
+        static bool EvaluatePreconditions(const Agent* pAgent, const PhasePreconditions_t& preconds);
+
+        //the preconditions and the effectors of each phase in the order of attaching, including the ones of E_BOTH,
+        //they are built by Attach so that a phase without any of them is skipped by an empty check
+        PhasePreconditions_t				m_enterPreconds;
+        PhasePreconditions_t				m_updatePreconds;
+        behaviac::vector<BehaviorNode*>		m_successEffectors;
+        behaviac::vector<BehaviorNode*>		m_failureEffectors;
         behaviac::vector<BehaviorNode*>		m_events;
     protected:
         typedef behaviac::vector<BehaviorNode*> Attachments;
@@ -322,6 +446,18 @@ namespace behaviac
 
         bool				m_bHasEvents;
         bool				m_loadAttachment;
+
+        //the hash of the loaded properties, pars and attachments, used to diff the reloaded trees
+        uint32_t			m_contentHash;
+
+        //the loaded strings combined in m_contentHash, they are only kept if the subtrees are shared,
+        //so that the nodes of the same hash are compared by their content
+        behaviac::string	m_sharingContent;
+
+        //the number of the parents sharing this node besides the one which owns it,
+        //m_parent is cleared once it is shared, as the one it is loaded into might be released before the sharing ones
+        uint32_t			m_sharedCount;
+        bool				m_bSharingRegistered;
         friend class BehaviorTree;
         friend class BehaviorTask;
         friend class Agent;
@@ -398,6 +534,48 @@ namespace behaviac
         bool IsFSM();
         void SetIsFSM(bool isFsm);
 
+        /**
+        when it is on, a SelectorLoop doesn't execute the precondition of a WithPrecondition again
+        if it only reads pars and properties of the agent and none of them is changed since it was executed for the agent.
+        the preconditions with members, methods or attachments are always executed.
+
+        a skipped precondition is not logged and doesn't stop at breakpoints. it is off by default and is kept when the tree is hot reloaded.
+        @sa WithPrecondition::IsPreconditionTracked
+        */
+        void SetPreconditionCaching(bool bCaching)
+        {
+            this->m_bPreconditionCaching = bCaching;
+        }
+
+        bool IsPreconditionCaching() const
+        {
+            return this->m_bPreconditionCaching;
+        }
+
+        /**
+        when it is on, a running state of the fsm doesn't evaluate its transitions again
+        if none of them was satisfied and none of the pars and properties of the agent they compare is changed since then.
+        the states with a transition comparing members or methods, or with an unconditional or a generated transition,
+        always evaluate them.
+
+        it is off by default and is kept when the tree is hot reloaded.
+        @sa TransitionTable::IsTracked
+        */
+        void SetTransitionCaching(bool bCaching)
+        {
+            this->m_bTransitionCaching = bCaching;
+        }
+
+        bool IsTransitionCaching() const
+        {
+            return this->m_bTransitionCaching;
+        }
+
+        /**
+        drop the loaded nodes and release the file mapping kept by the tree, see Workspace::SetFileMapping
+        */
+        void Clear();
+
     protected:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(BehaviorTree);
         BEHAVIAC_DECLARE_DYNAMIC_TYPE(BehaviorTree, BehaviorNode);
@@ -408,14 +586,55 @@ namespace behaviac
     private:
         virtual BehaviorTask* createTask() const;
         bool load_xml(char* pBuffer);
+        bool load_xml(rapidxml::xml_node<>* behaviorNode);
         bool load_bson(const char* pBuffer);
 
+        /**
+        exchange the loaded nodes, pars and attachments with 'other', the name and the tasks using this tree are kept
+        */
+        void SwapContent(BehaviorTree* other);
+
+        /**
+        keep 'pMapping' mapped until the tree is cleared or destroyed, the strings of the nodes loaded from it point into it
+        */
+        void KeepMapping(const char* pMapping, uint32_t mappingSize);
+
+        /**
+        share the identical subtrees with the trees loaded before, the ids of the nodes are kept in m_nodeIds.
+        @sa Workspace::SetSubtreeSharing
+        */
+        void ShareSubtrees();
+
+        /**
+        map each node id to the index of its task in the tasks collected by BehaviorTask::collecttasks,
+        so that BehaviorTreeTask::GetTaskById doesn't walk the tasks. it is done when the tree is loaded,
+        by walking the nodes as their tasks are created, no task is created.
+        */
+        void IndexTasks();
+
     protected:
         bool					m_bIsFSM;
         behaviac::string		m_name;
         behaviac::string		m_domains;
         Descriptors_t			m_descriptorRefs;
 
+        bool					m_bPreconditionCaching;
+        bool					m_bTransitionCaching;
+
+        //the ids of the nodes in the order of BehaviorTask::collectids, it is empty if no subtree is shared
+        behaviac::vector<int>	m_nodeIds;
+
+        //the index of the task of each node id, -1 if no task has the id, it is empty if the tree is not indexed
+        behaviac::vector<int>	m_taskIndices;
+
+        //the number of the tasks walked by IndexTasks, the tasks which don't create one for each child node,
+        //like the planner's, have fewer ones and so they are not indexed, see BehaviorTreeTask::IndexTasks
+        uint32_t				m_indexedTasksCount;
+
+        //the file mapping the tree is loaded from, it is kept as the strings of the nodes point into it
+        const char*				m_pMapping;
+        uint32_t				m_mappingSize;
+
         friend class BehaviorTreeTask;
         friend class BehaviorNode;
         friend class Workspace;
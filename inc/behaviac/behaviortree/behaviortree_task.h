@@ -78,7 +78,7 @@ namespace behaviac
         virtual void save(ISerializableNode* node) const = 0;
         virtual void load(ISerializableNode* node) = 0;
 
-        const behaviac::string& GetClassNameString() const;
+        const char* GetClassNameString() const;
         int GetId() const;
         void SetId(int id);
 
@@ -104,6 +104,7 @@ namespace behaviac
         void SetParent(BranchTask* parent)
         {
             this->m_parent = parent;
+            this->m_bTopManageBranchResolved = false;
         }
 
         const BranchTask* GetParent() const
@@ -148,6 +149,30 @@ namespace behaviac
         virtual const BehaviorTask* GetTaskById(int id) const;
         virtual int GetNextStateId() const;
 
+        /**
+        rebind the task to 'node' which is reloaded from the same source as its current node, its state is kept.
+        the children whose nodes are changed are recreated if they are not running.
+
+        return false if the task can't be kept, as its node or one of its running descendants' is changed.
+        */
+        virtual bool rebind(const BehaviorNode* node);
+
+        /**
+        append the ids of this task, its attachments and its descendants in the order they are created by Init
+        */
+        virtual void collectids(behaviac::vector<int>& ids) const;
+
+        /**
+        set the ids collected by collectids, 'index' is advanced past the ids used.
+        it is used when the nodes are shared by the trees, so that the tasks keep the ids in their own tree.
+        */
+        virtual void remapids(const behaviac::vector<int>& ids, uint32_t& index);
+
+        /**
+        append this task and its descendants in the order GetTaskById visits them, the attachments are not included
+        */
+        virtual void collecttasks(behaviac::vector<BehaviorTask*>& tasks);
+
     protected:
         BehaviorTask();
         virtual ~BehaviorTask();
@@ -164,6 +189,10 @@ namespace behaviac
         void Clear();
 
     private:
+        /**
+        the branch which records this task as its current task when it is running, so that the branch
+        execs it directly in the next exec. it only depends on the ancestors, so it is resolved once.
+        */
         BranchTask*		GetTopManageBranchTask();
         ///return true if it is continuing running for the next exec
         /**
@@ -181,12 +210,20 @@ namespace behaviac
         friend bool abort_handler(BehaviorTask* task, Agent* pAgent, void* user_data);
         friend bool reset_handler(BehaviorTask* task, Agent* pAgent, void* user_data);
         friend bool checkevent_handler(BehaviorTask* task, Agent* pAgent, void* user_data);
+        friend bool subscribeevents_handler(BehaviorTask* task, Agent* pAgent, void* user_data);
 
         void Attach(AttachmentTask* pAttachment);
 
         bool onenter_action(Agent* pAgent);
         void onexit_action(Agent* pAgent, EBTStatus status);
 
+        /**
+        register this running task to the agent's event index if its node has any event attached.
+        it is removed when the task exits, is aborted/reset or destroyed.
+        */
+        void SubscribeEvents(Agent* pAgent);
+        void UnsubscribeEvents();
+
         void FreeAttachments();
     protected:
         EBTStatus				m_status;
@@ -196,6 +233,12 @@ namespace behaviac
         Attachments*			m_attachments;
         int						m_id;
     private:
+        //the agent whose event index this task is registered to
+        Agent*					m_eventAgent;
+
+        //cached by GetTopManageBranchTask
+        BranchTask*				m_topManageBranch;
+        bool					m_bTopManageBranchResolved;
 
         //access m_status
         friend class BranchTask;
@@ -203,6 +246,9 @@ namespace behaviac
 
         //access update
         friend class BehaviorTreeTask;
+
+        //access m_eventAgent
+        friend class Agent;
     public:
         virtual bool CheckPreconditions(Agent* pAgent, bool bIsAlive);
     };
@@ -309,6 +355,10 @@ namespace behaviac
         BEHAVIAC_DECLARE_DYNAMIC_TYPE(CompositeTask, BranchTask);
 
         virtual void traverse(NodeHandler_t handler, Agent* pAgent, void* user_data);
+        virtual bool rebind(const BehaviorNode* node);
+        virtual void collectids(behaviac::vector<int>& ids) const;
+        virtual void remapids(const behaviac::vector<int>& ids, uint32_t& index);
+        virtual void collecttasks(behaviac::vector<BehaviorTask*>& tasks);
         BehaviorTask* GetChildById(int nodeId) const;
     protected:
         CompositeTask();
@@ -338,6 +388,10 @@ namespace behaviac
         BEHAVIAC_DECLARE_DYNAMIC_TYPE(SingeChildTask, BranchTask);
 
         virtual void traverse(NodeHandler_t handler, Agent* pAgent, void* user_data);
+        virtual bool rebind(const BehaviorNode* node);
+        virtual void collectids(behaviac::vector<int>& ids) const;
+        virtual void remapids(const behaviac::vector<int>& ids, uint32_t& index);
+        virtual void collecttasks(behaviac::vector<BehaviorTask*>& tasks);
     protected:
         SingeChildTask();
         virtual ~SingeChildTask();
@@ -410,6 +464,29 @@ namespace behaviac
         const behaviac::string& GetName() const;
 
         void Clear();
+
+        /**
+        keep the state after the tree is reloaded in place, 'previous' holds the nodes it was using.
+        the tasks of the unchanged nodes are rebound to the reloaded ones, the changed ones are recreated.
+
+        a changed running child of a Parallel or a SelectorLoop is restarted alone, its running siblings keep their state.
+
+        return false if the task has to be restarted, i.e. the tree's own content or any other running node is changed.
+        */
+        bool Rebind(const BehaviorTree* previous);
+
+        /**
+        the running tasks whose status is restored by CopyTo/Load are not in the agent's event index yet,
+        register them to 'pAgent'. it does nothing if the status is not restored since the last call.
+        */
+        void RestoreEventListeners(Agent* pAgent);
+
+        /**
+        look the task up in the tasks indexed by the tree's node ids, it is the same task as the one found by
+        walking the tasks, which is still done if the tree is not indexed.
+        @sa BehaviorTree::IndexTasks
+        */
+        virtual const BehaviorTask* GetTaskById(int id) const;
     protected:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(BehaviorTreeTask);
         BEHAVIAC_DECLARE_DYNAMIC_TYPE(BehaviorTreeTask, SingeChildTask);
@@ -443,6 +520,21 @@ namespace behaviac
         {
             return true;
         }
+
+        /**
+        the nodes might be shared by other trees, the ids are set to the ones in this tree
+        */
+        void RemapIds();
+
+        /**
+        collect the tasks to m_tasks if the tree is indexed, it is done again when the tasks are recreated
+        */
+        void IndexTasks();
+
+        bool m_bEventListenersRestored;
+
+        //the tasks in the order of collecttasks, BehaviorTree::m_taskIndices maps a node id to its index
+        behaviac::vector<BehaviorTask*> m_tasks;
     };
 } // namespace behaviac
 
@@ -44,6 +44,14 @@ namespace behaviac
         EBTStatus Execute(Agent* pAgent);
 
         EBTStatus Execute(const Agent* pAgent, EBTStatus childSatus);
+
+        /**
+        the return value of the method is kept in 'pReturn' instead of the method, so that the result of each task
+        is not overwritten by the other agents executing the node. 'pReturn' is created by 'CreateReturnValue' and owned by the caller.
+        if 'pReturn' is 0 and the return value is needed, a temporary is used.
+        */
+        EBTStatus Execute(const Agent* pAgent, EBTStatus childSatus, behaviac::IAsyncValue* pReturn);
+        behaviac::IAsyncValue* CreateReturnValue() const;
         static const char* ParseMethodNames(const char* fullName, char* agentIntanceName, char* agentClassName, char* methodName);
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
@@ -56,6 +64,9 @@ namespace behaviac
         EBTStatus			m_resultOption;
         CMethodBase*		m_resultFunctor;
 
+        //the method returns EBTStatus which is used as the result directly
+        bool				m_bStatusResult;
+
         friend class ActionTask;
     };
 
@@ -68,6 +79,7 @@ namespace behaviac
         virtual ~ActionTask();
 
     protected:
+        virtual void Init(const BehaviorNode* node);
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(ISerializableNode* node) const;
         virtual void load(ISerializableNode* node);
@@ -75,6 +87,9 @@ namespace behaviac
         virtual bool onenter(Agent* pAgent);
         virtual void onexit(Agent* pAgent, EBTStatus s);
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
+
+    private:
+        behaviac::IAsyncValue*	m_return;
     };
     /*! @} */
     /*! @} */
@@ -21,6 +21,8 @@
 
 namespace behaviac
 {
+    class VariableComparator;
+
     /*! \addtogroup treeNodes Behavior Tree
     * @{
     * \addtogroup Assignment
@@ -52,6 +54,8 @@ namespace behaviac
         Property*			m_opr;
         CMethodBase*		m_opr_m;
 
+        VariableComparator*	m_assignment;
+
         friend class AssignmentTask;
     };
 
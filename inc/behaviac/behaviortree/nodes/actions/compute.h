@@ -47,6 +47,11 @@ namespace behaviac
         virtual ~Compute();
         virtual void load(int version, const char* agentType, const properties_t& properties);
         static bool EvaluteCompute(Agent* pAgent, const behaviac::string& typeName, Property* opl, Property* opr1, CMethodBase* opr1_m, EComputeOperator computeOperator, Property* opr2, CMethodBase* opr2_m);
+
+        /**
+        create the computer of 'typeName' with its operands compiled, return 0 if 'typeName' is not registered
+        */
+        static VariableComputer* Create(const char* typeName, Property* opl, Property* opr1, CMethodBase* opr1_m, EComputeOperator computeOperator, Property* opr2, CMethodBase* opr2_m);
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
 
@@ -92,6 +97,8 @@ namespace behaviac
 
         behaviac::string	m_typeName;
 
+        VariableComputer*	m_computer;
+
         friend class ComputeTask;
     };
 
@@ -27,6 +27,7 @@ namespace behaviac
     class Task;
     class CTaskMethod;
     class Transition;
+    class TransitionTable;
 
     class BEHAVIAC_API ReferencedBehavior : public BehaviorNode
     {
@@ -50,7 +51,7 @@ namespace behaviac
     protected:
         behaviac::string				m_referencedBehaviorPath;
         CTaskMethod*					m_taskMethod;
-        behaviac::vector<Transition*>*	m_transitions;
+        TransitionTable*				m_transitions;
 
         friend class ReferencedBehaviorTask;
     };
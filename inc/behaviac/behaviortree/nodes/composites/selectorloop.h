@@ -73,6 +73,9 @@ namespace behaviac
         {
             return true;
         }
+
+        //true if the tree it is in keeps the results of the tracked preconditions
+        bool IsCachingPreconditions(Agent* pAgent) const;
     };
     /*! @} */
     /*! @} */
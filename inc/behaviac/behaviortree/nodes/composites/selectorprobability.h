@@ -46,6 +46,13 @@ namespace behaviac
         virtual BehaviorTask* createTask() const;
 
     protected:
+        /**
+        the optional 'RandomGenerator' method, it returns a value in [0, 1) used instead of the built-in random generator.
+
+        the value is looked up in an alias table, not by scanning the cumulative weights any more, so the children
+        are still picked in proportion to their weights over uniform values, but a given value may pick another child
+        than it used to. a method returning fixed or scripted values to pick a given child needs to be revised.
+        */
         CMethodBase*		m_method;
 
         friend class SelectorProbabilityTask;
@@ -76,6 +83,23 @@ namespace behaviac
 
         behaviac::vector<int>	m_weightingMap;
         int					m_totalSum;
+
+    private:
+        /**
+        read the weights of the children, the alias table is only rebuilt when any of them is changed
+        */
+        void UpdateWeights(Agent* pAgent);
+        void BuildAliasTable();
+
+        /**
+        pick a child by the alias table with 'random' in [0, 1], or -1 if all the weights are 0
+        */
+        int SelectChild(double random) const;
+
+        //the probability of keeping the i-th column and the child taking the rest of it
+        behaviac::vector<double>	m_aliasProbabilities;
+        behaviac::vector<uint32_t>	m_aliases;
+        behaviac::vector<uint32_t>	m_aliasWorklist;
     };
     /*! @} */
     /*! @} */
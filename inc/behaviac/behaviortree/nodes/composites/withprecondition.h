@@ -38,10 +38,30 @@ namespace behaviac
         WithPrecondition();
         virtual ~WithPrecondition();
         virtual void load(int version, const char* agentType, const properties_t& properties);
+        virtual void AddChild(BehaviorNode* pChild);
+
+        /**
+        return true if the precondition only reads the variables of GetPreconditionReads,
+        so that its result can be kept until any of them is changed.
+        @sa BehaviorTree::SetPreconditionCaching
+        */
+        bool IsPreconditionTracked() const
+        {
+            return this->m_bPreconditionTracked;
+        }
+
+        const behaviac::vector<uint32_t>& GetPreconditionReads() const
+        {
+            return this->m_preconditionReads;
+        }
+
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
     private:
         virtual BehaviorTask* createTask() const;
+
+        bool							m_bPreconditionTracked;
+        behaviac::vector<uint32_t>		m_preconditionReads;
     };
 
     class BEHAVIAC_API WithPreconditionTask : public SequenceTask
@@ -51,10 +71,21 @@ namespace behaviac
         WithPreconditionTask() : SequenceTask()
         {
             m_bIsUpdatePrecondition = false;
+            m_bCachingPrecondition = false;
+            m_cachedAgent = 0;
+            m_cachedNode = 0;
+            m_cachedVersion = 0;
+            m_cachedStatus = BT_INVALID;
         }
         virtual void addChild(BehaviorTask* pBehavior);
         bool GetIsUpdatePrecondition();
         void SetIsUpdatePrecondition(bool value);
+
+        /**
+        execute the precondition, if 'bCaching' is true and the variables it reads are not changed since it was executed
+        for 'pAgent' last time, the last result is returned without executing it.
+        */
+        EBTStatus UpdatePrecondition(Agent* pAgent, bool bCaching);
     protected:
         virtual void copyto(BehaviorTask* target) const;
         virtual void save(ISerializableNode* node) const;
@@ -65,6 +96,14 @@ namespace behaviac
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
     private:
         bool m_bIsUpdatePrecondition;
+        bool m_bCachingPrecondition;
+
+        //the result of the precondition, it is valid for m_cachedAgent and m_cachedNode only
+        const Agent*			m_cachedAgent;
+        const BehaviorNode*		m_cachedNode;
+        uint32_t				m_cachedVersion;
+        EBTStatus				m_cachedStatus;
+
         friend class SelectorLoopTask;
     };
     /*! @} */
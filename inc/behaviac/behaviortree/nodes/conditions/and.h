@@ -38,6 +38,7 @@ namespace behaviac
         virtual ~And();
         virtual void load(int version, const char* agentType, const properties_t& properties);
         virtual bool Evaluate(Agent* pAgent);
+        virtual bool GetReadVariables(behaviac::vector<uint32_t>& variableIds) const;
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
     private:
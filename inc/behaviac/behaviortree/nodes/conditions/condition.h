@@ -54,9 +54,16 @@ namespace behaviac
     public:
         static VariableComparator* Create(const char* typeName, const char* comparionOperator, Property* lhs, CMethodBase* lhs_m, Property* rhs, CMethodBase* rhs_m);
 
+        /**
+        create the comparator of 'typeName' to assign 'rhs' or the return value of 'rhs_m' to 'lhs',
+        return 0 if 'typeName' is not registered or is an agent type
+        */
+        static VariableComparator* CreateAssignment(const char* typeName, Property* lhs, Property* rhs, CMethodBase* rhs_m);
+
         static void Cleanup();
 
         static Property* LoadLeft(const char* value);
+        static Property* LoadLeft(const char* value, behaviac::string& typeName);
         static Property* LoadRight(const char* value, behaviac::string& typeName);
         static Property* ParseProperty(const char* value, behaviac::string& typeName);
 
@@ -85,6 +92,7 @@ namespace behaviac
         virtual ~Condition();
         virtual void load(int version, const char* agentType, const properties_t& properties);
         virtual bool Evaluate(Agent* pAgent);
+        virtual bool GetReadVariables(behaviac::vector<uint32_t>& variableIds) const;
 
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
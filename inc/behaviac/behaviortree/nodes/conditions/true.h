@@ -37,6 +37,7 @@ namespace behaviac
         True();
         virtual ~True();
         virtual void load(int version, const char* agentType, const properties_t& properties);
+        virtual bool GetReadVariables(behaviac::vector<uint32_t>& variableIds) const;
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
     private:
@@ -72,6 +72,9 @@ namespace behaviac
     private:
         int	m_start;
         int	m_frames;
+
+        //decorate has no agent, the context whose clock is used is kept from onenter
+        int	m_contextId;
     };
     /*! @} */
     /*! @} */
@@ -18,6 +18,7 @@ namespace behaviac
 
         void SetInitialId(int initialId);
         int GetInitialId() const;
+        virtual bool IsSharable() const;
     protected:
         virtual void load(int version, const char* agentType, const properties_t& properties);
         virtual BehaviorTask* createTask() const;
@@ -46,6 +47,12 @@ namespace behaviac
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
 
         EBTStatus UpdateFSM(Agent* pAgent, EBTStatus childStatus);
+
+    private:
+        /**
+        the states are looked up in the tasks indexed by the tree when the fsm is the tree's root
+        */
+        BehaviorTask* GetStateById(int id);
     };
 
 }
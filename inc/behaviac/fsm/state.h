@@ -5,10 +5,11 @@
 #include "behaviac/behaviortree/behaviortree_task.h"
 #include "behaviac/property/property.h"
 #include "behaviac/behaviortree/nodes/actions/action.h"
+#include "behaviac/fsm/transitioncondition.h"
 
 namespace behaviac
 {
-    class Transition;
+    class StateTask;
     // ============================================================================
     class BEHAVIAC_API State : public BehaviorNode
     {
@@ -25,14 +26,26 @@ namespace behaviac
     public:
         virtual void Attach(BehaviorNode* pAttachment, bool bIsPrecondition, bool bIsEffector, bool bIsTransition);
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
+        virtual bool IsSharable() const;
 		bool IsEndState() const;
 
-        EBTStatus Update(Agent* pAgent, int& nextStateId);
-        static bool UpdateTransitions(Agent* pAgent, const BehaviorNode* node, const behaviac::vector<Transition*>* transitions, int& nextStateId);
+        /**
+        'pTask' keeps the version of the agent's variables when none of the transitions was satisfied,
+        the transitions are not evaluated again until one of the variables they read is changed.
+        @sa BehaviorTree::SetTransitionCaching
+        */
+        EBTStatus Update(Agent* pAgent, int& nextStateId, StateTask* pTask = 0);
+        static bool UpdateTransitions(Agent* pAgent, const BehaviorNode* node, const TransitionTable* transitions, int& nextStateId);
+
+        const TransitionTable& GetTransitionTable() const
+        {
+            return this->m_transitionTable;
+        }
     protected:
 		bool							m_bIsEndState;
         CMethodBase*					m_method;
         behaviac::vector<Transition*>	m_transitions;
+        TransitionTable					m_transitionTable;
     };
 
     class StateTask : public LeafTask
@@ -51,8 +64,18 @@ namespace behaviac
         virtual bool onenter(Agent* pAgent);
         virtual void onexit(Agent* pAgent, EBTStatus s);
         virtual EBTStatus update(Agent* pAgent, EBTStatus childStatus);
+
+    private:
+        bool IsCachingTransitions(Agent* pAgent) const;
+
+        friend class State;
 	protected:
         int m_nextStateId;
+
+    private:
+        //the agent and the version of its variables when none of the transitions was satisfied
+        const Agent*	m_cachedAgent;
+        uint32_t		m_cachedVersion;
     };
 
 }
@@ -43,6 +43,14 @@ namespace behaviac
     public:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
 
+        /**
+        return true if 'Evaluate' always returns true, the transitions after it are never taken
+        */
+        virtual bool IsUnconditional() const
+        {
+            return false;
+        }
+
     protected:
         virtual BehaviorTask* createTask() const
         {
@@ -51,5 +59,56 @@ namespace behaviac
             return NULL;
         }
     };
+
+    /**
+    the transitions of a state compiled when they are attached, the first one satisfied is taken.
+
+    a transition loaded as a comparison is evaluated by its typed comparator directly instead of 'Evaluate',
+    the others, like the generated ones, still use 'Evaluate'.
+    the transitions after an unconditional one are never taken, so they are not kept.
+    */
+    class BEHAVIAC_API TransitionTable
+    {
+    public:
+        TransitionTable();
+
+        void Add(Transition* pTransition);
+
+        /**
+        return the first satisfied transition, 0 if none is satisfied
+        */
+        Transition* Evaluate(Agent* pAgent) const;
+
+        /**
+        return true if all of the transitions only compare the variables in GetReadVariables,
+        so that none of them is satisfied until one of those variables is changed
+        */
+        bool IsTracked() const
+        {
+            return this->m_bTracked;
+        }
+
+        const behaviac::vector<uint32_t>& GetReadVariables() const
+        {
+            return this->m_readVariables;
+        }
+
+        uint32_t GetCount() const
+        {
+            return (uint32_t)this->m_entries.size();
+        }
+
+    private:
+        struct Entry
+        {
+            Transition*					transition;
+            const VariableComparator*	comparator;
+        };
+
+        behaviac::vector<Entry>		m_entries;
+        behaviac::vector<uint32_t>	m_readVariables;
+        bool						m_bTracked;
+        bool						m_bUnconditional;
+    };
 }
 #endif
@@ -34,6 +34,11 @@ namespace behaviac
 
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
 
+        virtual bool IsUnconditional() const
+        {
+            return true;
+        }
+
     protected:
         virtual void load(int version, const char* agentType, const properties_t& properties);
 		virtual bool Evaluate(Agent* pAgent);
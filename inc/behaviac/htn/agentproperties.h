@@ -41,6 +41,7 @@ namespace behaviac
         Property* AddProperty(const char* typeName, bool bIsStatic, const char* variableName, const char* valueStr, const char* agentType);
 
         static Property* AddLocal(const char* agentType, const char* typeName, const char* variableName, const char* valueStr);
+        static void AddLocal(const char* agentType, Property* pLocal);
         static Property* GetProperty(const char* agentType, const char* variableName);
         static Property* GetProperty(const char* agentType, uint32_t variableId);
         static AgentProperties* Get(const char* agentType);
@@ -55,6 +56,10 @@ namespace behaviac
         static void SetInstance(CppBehaviorLoader* cppBehaviorLoader);
         static void SetAgentTypeBlackboards(const char* agentType, AgentProperties* agentProperties);
 
+        //guards the locals added by AddLocal, the workers of Workspace::HotReloadAsync hold it while building a tree,
+        //the main thread reads them without the lock
+        static behaviac::Mutex ms_localsCs;
+
     private:
         static CppBehaviorLoader* ms_cppBehaviorLoader;
         static map<behaviac::string, AgentProperties*> agent_type_blackboards;
@@ -36,6 +36,7 @@ namespace behaviac
 
     public:
         virtual bool decompose(BehaviorNode* node, PlannerTaskComplex* seqTask, int depth, Planner* planner);
+        virtual bool IsSharable() const;
 
     protected:
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
@@ -155,6 +155,7 @@ namespace behaviac
     {
     public:
         PlannerTaskReference(BehaviorNode* node, Agent* pAgent);
+        virtual ~PlannerTaskReference();
 
         AgentState* currentState;
 
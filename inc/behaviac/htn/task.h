@@ -33,6 +33,7 @@ namespace behaviac
         }
         virtual bool decompose(BehaviorNode* node, PlannerTaskComplex* seqTask, int depth, Planner* planner);
         virtual bool IsValid(Agent* pAgent, BehaviorTask* pTask) const;
+        virtual bool IsSharable() const;
         virtual BehaviorTask* createTask() const;
         int FindMethodIndex(Method* method);
         bool			IsHTN();
@@ -60,6 +61,8 @@ namespace behaviac
         virtual void save(ISerializableNode* node) const;
 
         virtual void load(ISerializableNode* node);
+
+        virtual bool rebind(const BehaviorNode* node);
     protected:
         virtual bool onenter(Agent* pAgent);
         virtual void onexit(Agent* pAgent, EBTStatus s);
@@ -18,6 +18,7 @@
 #include "behaviac/agent/agent.h"
 #include "behaviac/property/property_t.h"
 #include "behaviac/property/operators.inl"
+#include "behaviac/property/operand.h"
 
 #include <vector>
 #include <string>
@@ -60,6 +61,17 @@ namespace behaviac
 
         virtual bool Execute(const Agent* pAgent) const = 0;
 
+        /**
+        add the ids of the variables read by Execute to 'variableIds',
+        it returns false if Execute reads anything else or writes anything.
+        */
+        virtual bool GetReadVariables(behaviac::vector<uint32_t>& variableIds) const
+        {
+            BEHAVIAC_UNUSED_VAR(variableIds);
+
+            return false;
+        }
+
         void SetProperty(Property* lhs, CMethodBase* lhs_m, Property* rhs, CMethodBase* rhs_m)
         {
             m_lhs = lhs;
@@ -121,159 +133,48 @@ namespace behaviac
         return m_comparisonType;
     }
 
-    template< typename VariableType >
-    class VariableComparatorImpl : public VariableComparatorImpl_<VariableType>
-    {
-    protected:
-        VariableComparatorImpl(const VariableComparatorImpl& copy) : VariableComparatorImpl_<VariableType>(copy)
-        {}
-    public:
-        VariableComparatorImpl()
-        {}
-
-        virtual VariableComparator* clone()
-        {
-            return BEHAVIAC_NEW VariableComparatorImpl(*this);
-        }
-
-        virtual bool Execute(const Agent* pAgent) const;
-    };
-
     //------------------------------------------------------------------------
     template< typename VariableType >
-    inline bool VariableComparatorImpl< VariableType >::Execute(const Agent* pAgent) const
+    struct VariableCompare
     {
-        TProperty<VariableType>* pTP_lhs = NULL;
-        VariableType lhs;
-        Agent* agentL = (Agent*)pAgent;
-
-        if (this->m_lhs)
-        {
-            agentL = this->m_lhs->GetParentAgent(agentL);
-            pTP_lhs = (TProperty<VariableType>*)this->m_lhs;
-            lhs = pTP_lhs->GetValue(agentL);
-        }
-        else
-        {
-            BEHAVIAC_ASSERT(this->m_lhs_m);
-            this->m_lhs_m->Invoke(agentL);
-            bool bOk = this->m_lhs_m->GetReturnValue(agentL, lhs);
-            BEHAVIAC_ASSERT(bOk);
-            BEHAVIAC_UNUSED_VAR(bOk);
-        }
-
-        VariableType rhs;
-        Agent* agentR = (Agent*)pAgent;
-
-        if (this->m_rhs)
-        {
-            agentR = this->m_rhs->GetParentAgent(agentR);
-            TProperty<VariableType>* pTP_rhs = (TProperty<VariableType>*)this->m_rhs;
-            rhs = pTP_rhs->GetValue(agentR);
-        }
-        else
+        static bool Execute(E_VariableComparisonType comparisonType, const VariableType& lhs, const VariableType& rhs)
         {
-            BEHAVIAC_ASSERT(this->m_rhs_m);
-            this->m_rhs_m->Invoke(agentR);
-            bool bOk = this->m_rhs_m->GetReturnValue(agentR, rhs);
-            BEHAVIAC_ASSERT(bOk);
-            BEHAVIAC_UNUSED_VAR(bOk);
-        }
-
-        switch (this->m_comparisonType)
-        {
-            case VariableComparisonType_Assignment:
-                BEHAVIAC_ASSERT(this->m_lhs && pTP_lhs);
-                pTP_lhs->SetValue(agentL, rhs);
-                break;
+            switch (comparisonType)
+            {
+                case VariableComparisonType_Equal:
+                    return Details::Equal(lhs, rhs);
 
-            case VariableComparisonType_Equal:
-                return Details::Equal(lhs, rhs);
+                case VariableComparisonType_NotEqual:
+                    return !Details::Equal(lhs, rhs);
 
-            case VariableComparisonType_NotEqual:
-                return !Details::Equal(lhs, rhs);
+                case VariableComparisonType_Greater:
+                    return Details::Greater(lhs, rhs);
 
-            case VariableComparisonType_Greater:
-                return Details::Greater(lhs, rhs);
+                case VariableComparisonType_GreaterEqual:
+                    return Details::GreaterEqual(lhs, rhs);
 
-            case VariableComparisonType_GreaterEqual:
-                return Details::GreaterEqual(lhs, rhs);
+                case VariableComparisonType_Less:
+                    return Details::Less(lhs, rhs);
 
-            case VariableComparisonType_Less:
-                return Details::Less(lhs, rhs);
+                case VariableComparisonType_LessEqual:
+                    return Details::LessEqual(lhs, rhs);
 
-            case VariableComparisonType_LessEqual:
-                return Details::LessEqual(lhs, rhs);
+                default:
+                    BEHAVIAC_ASSERT(0, "Unsupported comparison type");
+                    break;
+            }
 
-            default:
-                BEHAVIAC_ASSERT(0, "Unsupported comparison type");
-                break;
+            return false;
         }
-
-        return false;
-    }
+    };
 
     template<>
-    class VariableComparatorImpl<bool> : public VariableComparatorImpl_<bool>
+    struct VariableCompare<bool>
     {
-    protected:
-        VariableComparatorImpl(const VariableComparatorImpl& copy) : VariableComparatorImpl_<bool>(copy)
-        {}
-    public:
-        VariableComparatorImpl()
-        {}
-
-        virtual VariableComparator* clone()
+        static bool Execute(E_VariableComparisonType comparisonType, const bool& lhs, const bool& rhs)
         {
-            return BEHAVIAC_NEW VariableComparatorImpl(*this);
-        }
-
-        virtual bool Execute(const Agent* pAgent) const
-        {
-            TProperty<bool>* pTP_lhs = NULL;
-            bool lhs = false;
-            Agent* agentL = (Agent*)pAgent;
-
-            if (this->m_lhs)
-            {
-                agentL = this->m_lhs->GetParentAgent(agentL);
-                pTP_lhs = (TProperty<bool>*)this->m_lhs;
-                lhs = pTP_lhs->GetValue(agentL);
-            }
-            else
-            {
-                BEHAVIAC_ASSERT(this->m_lhs_m);
-                this->m_lhs_m->Invoke(agentL);
-                bool bOk = this->m_lhs_m->GetReturnValue(agentL, lhs);
-                BEHAVIAC_UNUSED_VAR(bOk);
-                BEHAVIAC_ASSERT(bOk);
-            }
-
-            bool rhs = false;
-            Agent* agentR = (Agent*)pAgent;
-
-            if (this->m_rhs)
-            {
-                agentR = this->m_rhs->GetParentAgent(agentR);
-                TProperty<bool>* pTP_rhs = (TProperty<bool>*)this->m_rhs;
-                rhs = pTP_rhs->GetValue(agentR);
-            }
-            else
-            {
-                BEHAVIAC_ASSERT(this->m_rhs_m);
-                this->m_rhs_m->Invoke(agentR);
-                bool bOk = this->m_rhs_m->GetReturnValue(agentR, rhs);
-                BEHAVIAC_UNUSED_VAR(bOk);
-                BEHAVIAC_ASSERT(bOk);
-            }
-
-            switch (this->m_comparisonType)
+            switch (comparisonType)
             {
-                case VariableComparisonType_Assignment:
-                    BEHAVIAC_ASSERT(this->m_lhs && pTP_lhs);
-                    pTP_lhs->SetValue(agentL, rhs);
-                    break;
-
                 case VariableComparisonType_Equal:
                     return Details::Equal(lhs, rhs);
 
@@ -306,6 +207,86 @@ namespace behaviac
             return false;
         }
     };
+
+    /**
+    the operands are compiled in 'SetProperty', 'Execute' loads them and compares them,
+    or stores the right one to the left one for VariableComparisonType_Assignment.
+    */
+    template< typename VariableType >
+    class VariableComparatorImpl : public VariableComparatorImpl_<VariableType>
+    {
+    protected:
+        VariableComparatorImpl(const VariableComparatorImpl& copy) : VariableComparatorImpl_<VariableType>(copy), m_l(copy.m_l), m_r(copy.m_r)
+        {}
+    public:
+        VariableComparatorImpl()
+        {}
+
+        virtual VariableComparator* clone()
+        {
+            return BEHAVIAC_NEW VariableComparatorImpl(*this);
+        }
+
+        void SetProperty(Property* lhs, CMethodBase* lhs_m, Property* rhs, CMethodBase* rhs_m)
+        {
+            VariableComparator::SetProperty(lhs, lhs_m, rhs, rhs_m);
+
+            //an assignment calls the method of the right one with its own agent as the holder of the pars,
+            //the same as Property::SetFrom
+            bool bAssignment = this->m_comparisonType == VariableComparisonType_Assignment;
+
+            this->m_l.Compile(lhs, lhs_m);
+            this->m_r.Compile(rhs, rhs_m, bAssignment);
+        }
+
+        virtual bool Execute(const Agent* pAgent) const;
+
+        virtual bool GetReadVariables(behaviac::vector<uint32_t>& variableIds) const
+        {
+            if (this->m_comparisonType == VariableComparisonType_Assignment)
+            {
+                return false;
+            }
+
+            return this->m_l.GetReadVariables(variableIds) && this->m_r.GetReadVariables(variableIds);
+        }
+
+    private:
+        TOperand<VariableType>	m_l;
+        TOperand<VariableType>	m_r;
+    };
+
+    //------------------------------------------------------------------------
+    template< typename VariableType >
+    inline bool VariableComparatorImpl< VariableType >::Execute(const Agent* pAgent) const
+    {
+        if (this->m_comparisonType == VariableComparisonType_Assignment)
+        {
+            BEHAVIAC_ASSERT(this->m_lhs);
+
+            VariableType rhsValue;
+            const VariableType& rhs = this->m_r.Load(pAgent, rhsValue);
+
+            this->m_l.Store(pAgent, rhs);
+
+            return false;
+        }
+
+        VariableType lhsValue;
+        const VariableType* lhs = &this->m_l.Load(pAgent, lhsValue);
+
+        //the method of the right one might change what the left one refers to, so it is compared as it was read
+        if (this->m_r.IsMethod() && lhs != &lhsValue)
+        {
+            lhsValue = *lhs;
+            lhs = &lhsValue;
+        }
+
+        VariableType rhsValue;
+        const VariableType& rhs = this->m_r.Load(pAgent, rhsValue);
+
+        return VariableCompare<VariableType>::Execute(this->m_comparisonType, *lhs, rhs);
+    }
 }
 
 #endif//BEHAVIAC_COMPARISOR_H
@@ -18,6 +18,7 @@
 #include "behaviac/agent/agent.h"
 #include "behaviac/property/property_t.h"
 #include "behaviac/property/operators.inl"
+#include "behaviac/property/operand.h"
 
 #include <vector>
 #include <string>
@@ -48,17 +49,29 @@ namespace behaviac
                              Property* opr1, CMethodBase* opr1_m,
                              EComputeOperator computeOperator,
                              Property* opr2, CMethodBase* opr2_m) const = 0;
+
+        /**
+        create a computer whose operands are compiled from the properties and the methods,
+        it is executed by 'Execute(pSelf)' and is to be deleted by the caller.
+        */
+        virtual VariableComputer* Compile(Property* opl,
+                                          Property* opr1, CMethodBase* opr1_m,
+                                          EComputeOperator computeOperator,
+                                          Property* opr2, CMethodBase* opr2_m) const = 0;
+
+        virtual bool Execute(Agent* pSelf) const = 0;
     };
 
     template< typename VariableType >
     class VariableComputerImpl : public VariableComputer
     {
     protected:
-        VariableComputerImpl(const VariableComputerImpl& copy) : VariableComputer(copy)
+        VariableComputerImpl(const VariableComputerImpl& copy) : VariableComputer(copy),
+            m_opl(copy.m_opl), m_opr1(copy.m_opr1), m_opr2(copy.m_opr2), m_operator(copy.m_operator)
         {}
     public:
         BEHAVIAC_DECLARE_MEMORY_OPERATORS(VariableComputerImpl);
-        VariableComputerImpl()
+        VariableComputerImpl() : m_operator(ECO_INVALID)
         {}
 
         virtual VariableComputer* clone()
@@ -71,6 +84,29 @@ namespace behaviac
                              Property* opr1, CMethodBase* opr1_m,
                              EComputeOperator computeOperator,
                              Property* opr2, CMethodBase* opr2_m) const;
+
+        virtual VariableComputer* Compile(Property* opl,
+                                          Property* opr1, CMethodBase* opr1_m,
+                                          EComputeOperator computeOperator,
+                                          Property* opr2, CMethodBase* opr2_m) const
+        {
+            VariableComputerImpl* pComputer = BEHAVIAC_NEW VariableComputerImpl(*this);
+
+            pComputer->m_opl.Compile(opl, 0);
+            pComputer->m_opr1.Compile(opr1, opr1_m);
+            pComputer->m_opr2.Compile(opr2, opr2_m);
+            pComputer->m_operator = computeOperator;
+
+            return pComputer;
+        }
+
+        virtual bool Execute(Agent* pSelf) const;
+
+    private:
+        TOperand<VariableType>	m_opl;
+        TOperand<VariableType>	m_opr1;
+        TOperand<VariableType>	m_opr2;
+        EComputeOperator		m_operator;
     };
 
     //------------------------------------------------------------------------
@@ -95,7 +131,7 @@ namespace behaviac
         }
         else
         {
-            bool bOk = _opr1_m->GetReturnValue(pSelf, opr1);
+            bool bOk = _opr1_m->Invoke(_opr1_m->GetParentAgent(pSelf), pSelf, opr1);
             BEHAVIAC_UNUSED_VAR(bOk);
             BEHAVIAC_ASSERT(bOk);
         }
@@ -110,7 +146,7 @@ namespace behaviac
         }
         else
         {
-            bool bOk = _opr2_m->GetReturnValue(pSelf, opr2);
+            bool bOk = _opr2_m->Invoke(_opr2_m->GetParentAgent(pSelf), pSelf, opr2);
             BEHAVIAC_ASSERT(bOk);
             BEHAVIAC_UNUSED_VAR(bOk);
         }
@@ -146,6 +182,47 @@ namespace behaviac
 
         return false;
     }
+
+    template< typename VariableType >
+    bool VariableComputerImpl< VariableType >::Execute(Agent* pSelf) const
+    {
+        BEHAVIAC_ASSERT(this->m_opl.IsValid() && this->m_opr1.IsValid() && this->m_opr2.IsValid());
+
+        VariableType opr1Value;
+        const VariableType opr1 = this->m_opr1.Load(pSelf, opr1Value);
+
+        VariableType opr2Value;
+        const VariableType opr2 = this->m_opr2.Load(pSelf, opr2Value);
+
+        VariableType result;
+
+        switch (this->m_operator)
+        {
+            case ECO_ADD:
+                result = opr1 + opr2;
+                break;
+
+            case ECO_SUB:
+                result = opr1 - opr2;
+                break;
+
+            case ECO_MUL:
+                result = opr1 * opr2;
+                break;
+
+            case ECO_DIV:
+                result = opr1 / opr2;
+                break;
+
+            default:
+                BEHAVIAC_ASSERT(0, "Unsupported computer type");
+                return false;
+        }
+
+        this->m_opl.Store(pSelf, result);
+
+        return true;
+    }
 }
 
 #endif//BEHAVIAC_COMPUTER_H
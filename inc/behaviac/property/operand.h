@@ -0,0 +1,205 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BEHAVIAC_OPERAND_H
+#define BEHAVIAC_OPERAND_H
+
+#include "behaviac/property/property.h"
+#include "behaviac/agent/agent.h"
+#include "behaviac/property/property_t.h"
+
+namespace behaviac
+{
+    /**
+    where the value of an operand is read from, it is decided once when the operand is compiled
+    */
+    enum EOperandKind
+    {
+        EOK_NONE,
+        EOK_CONST,          //a literal, read from the default value of the property
+        EOK_MEMBER,         //a member of the agent itself, read from the member directly
+        EOK_VARIABLE,       //a par or a property of the agent itself, read by the variable id
+        EOK_PROPERTY,       //any other property, like the one of a named instance or an element of a vector
+        EOK_CALL,           //a method returning the operand's type, its return value is written to the operand's storage
+        EOK_METHOD          //a method returning another type, its return value is kept in a temporary and converted
+    };
+
+    /**
+    an operand of Condition, Compute and Assignment, compiled from its Property or method when the node is loaded.
+
+    'Load' and 'Store' only switch on the kind, the instance name, the member and the return type
+    are not checked again on each tick.
+    */
+    template<typename T>
+    class TOperand
+    {
+    public:
+        TOperand() : m_kind(EOK_NONE), m_property(0), m_method(0), m_const(0), m_member(0), m_variableId(0), m_bParentHolder(false)
+        {}
+
+        /**
+        'bParentHolder' is true if a method is to be called with its own agent as the holder of the pars of its params,
+        otherwise it is the agent the operand is loaded for.
+        */
+        void Compile(Property* p, CMethodBase* m, bool bParentHolder = false)
+        {
+            this->m_kind = EOK_NONE;
+            this->m_property = p;
+            this->m_method = m;
+            this->m_const = 0;
+            this->m_member = 0;
+            this->m_variableId = 0;
+            this->m_bParentHolder = bParentHolder;
+
+            if (p)
+            {
+                TProperty<T>* pT = (TProperty<T>*)p;
+
+                if (p->IsVectorElement() || !p->IsSelf())
+                {
+                    this->m_kind = EOK_PROPERTY;
+                }
+                else if (p->IsConst())
+                {
+                    this->m_kind = EOK_CONST;
+                    this->m_const = &pT->GetDefaultValue();
+                }
+                else if (p->GetMember())
+                {
+                    this->m_kind = EOK_MEMBER;
+                    this->m_member = p->GetMember();
+                }
+                else
+                {
+                    this->m_kind = EOK_VARIABLE;
+                    this->m_variableId = p->GetVariableId();
+                }
+            }
+            else if (m)
+            {
+                this->m_kind = m->IsReturnType<T>() ? EOK_CALL : EOK_METHOD;
+            }
+        }
+
+        bool IsValid() const
+        {
+            return this->m_kind != EOK_NONE;
+        }
+
+        bool IsMethod() const
+        {
+            return this->m_kind == EOK_CALL || this->m_kind == EOK_METHOD;
+        }
+
+        /**
+        add the id of the variable it reads to 'variableIds', a constant reads nothing.
+        it returns false if it reads anything else, like a member, a static property or a method,
+        or a vector, whose elements are written in place.
+        */
+        bool GetReadVariables(behaviac::vector<uint32_t>& variableIds) const
+        {
+            if (this->m_kind == EOK_CONST)
+            {
+                return true;
+            }
+
+            if (this->m_kind == EOK_VARIABLE && !this->m_property->m_bIsStatic && !behaviac::Meta::IsVector<T>::Result)
+            {
+                variableIds.push_back(this->m_variableId);
+
+                return true;
+            }
+
+            return false;
+        }
+
+        /**
+        return the value of the operand for 'pSelf', 'storage' is only used when the value has to be copied,
+        like the return value of a method.
+        */
+        const T& Load(const Agent* pSelf, T& storage) const
+        {
+            switch (this->m_kind)
+            {
+                case EOK_CONST:
+                    return *this->m_const;
+
+                case EOK_MEMBER:
+                    return *(const T*)this->m_member->Get(pSelf, GetClassTypeNumberId<T>());
+
+                case EOK_VARIABLE:
+                    return pSelf->GetVariable<T>(this->m_variableId);
+
+                case EOK_PROPERTY:
+                {
+                    Agent* pParent = this->m_property->GetParentAgent(pSelf);
+
+                    return ((TProperty<T>*)this->m_property)->GetValue(pParent);
+                }
+
+                case EOK_CALL:
+                {
+                    const Agent* pParent = this->m_method->IsSelf() ? pSelf : this->m_method->GetParentAgent(pSelf);
+                    const Agent* pHolder = this->m_bParentHolder ? pParent : pSelf;
+
+                    this->m_method->Call(pParent, pHolder, &storage);
+
+                    return storage;
+                }
+
+                case EOK_METHOD:
+                {
+                    const Agent* pHolder = this->m_bParentHolder ? this->m_method->GetParentAgent(pSelf) : pSelf;
+                    const Agent* pParent = this->m_method->GetParentAgent(pHolder);
+
+                    bool bOk = this->m_method->Invoke(pParent, pHolder, storage);
+                    BEHAVIAC_ASSERT(bOk);
+                    BEHAVIAC_UNUSED_VAR(bOk);
+
+                    return storage;
+                }
+
+                default:
+                    BEHAVIAC_ASSERT(0, "the operand is not compiled");
+                    break;
+            }
+
+            return storage;
+        }
+
+        void Store(const Agent* pSelf, const T& value) const
+        {
+            BEHAVIAC_ASSERT(this->m_property);
+
+            Agent* pParent = (Agent*)pSelf;
+
+            if (this->m_kind == EOK_PROPERTY)
+            {
+                pParent = this->m_property->GetParentAgent(pSelf);
+            }
+
+            ((TProperty<T>*)this->m_property)->SetValue(pParent, value);
+        }
+
+    private:
+        EOperandKind		m_kind;
+        Property*			m_property;
+        CMethodBase*		m_method;
+        const T*			m_const;
+        const CMemberBase*	m_member;
+        uint32_t			m_variableId;
+        bool				m_bParentHolder;
+    };
+}
+
+#endif//BEHAVIAC_OPERAND_H
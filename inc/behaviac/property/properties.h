@@ -31,14 +31,14 @@ namespace behaviac
     {
     public:
         IVariable(const CMemberBase* pMember, const char* variableName, uint32_t id) :
-            m_id(id), m_name(variableName), m_property(0), m_pMember(pMember), m_instantiated(1)
+            m_id(id), m_name(variableName), m_property(0), m_pMember(pMember), m_version(0), m_instantiated(1)
 #if !defined(BEHAVIAC_RELEASE)
             , m_changed(true)
 #endif
         {}
 
         IVariable(const CMemberBase* pMember, const Property* property_) :
-            m_property(property_), m_pMember(pMember), m_instantiated(1)
+            m_property(property_), m_pMember(pMember), m_version(0), m_instantiated(1)
 #if !defined(BEHAVIAC_RELEASE)
             , m_changed(true)
 #endif
@@ -50,7 +50,7 @@ namespace behaviac
         }
 
         IVariable(const IVariable& copy) :
-            m_id(copy.m_id), m_name(copy.m_name), m_property(copy.m_property), m_pMember(copy.m_pMember), m_instantiated(copy.m_instantiated)
+            m_id(copy.m_id), m_name(copy.m_name), m_property(copy.m_property), m_pMember(copy.m_pMember), m_version(copy.m_version), m_instantiated(copy.m_instantiated)
 #if !defined(BEHAVIAC_RELEASE)
             , m_changed(copy.m_changed)
 #endif
@@ -117,6 +117,8 @@ namespace behaviac
         behaviac::string	m_name;
         const Property*		m_property;
         const CMemberBase*	m_pMember;
+        //the version of the Variables it is in when it was changed last time
+        uint32_t			m_version;
         unsigned char		m_instantiated;
 #if !defined(BEHAVIAC_RELEASE)
         bool				m_changed;
@@ -154,8 +156,13 @@ namespace behaviac
             return this->m_value;
         }
 
-        void SetValue(const VariableType& value, Agent* pAgent)
+        /**
+        return true if the value is changed or if 'value' is the variable itself, which has been written through
+        the reference returned by GetValue, like an out param of a method
+        */
+        bool SetValue(const VariableType& value, Agent* pAgent)
         {
+            bool bChanged = &value == &this->m_value;
             bool bProperty = false;
 
             if (this->m_pMember)
@@ -178,13 +185,15 @@ namespace behaviac
 #if !defined(BEHAVIAC_RELEASE)
                 this->m_changed = true;
 #endif
-
+                bChanged = true;
             }
             else
             {
                 //don't clear it here, it will be cleared after being logged
                 //this->m_changed = false;
             }
+
+            return bChanged;
         }
 
         virtual int GetTypeId() const
@@ -316,6 +325,21 @@ namespace behaviac
 
         void Clear();
 
+        /**
+        the version is increased whenever a variable is created or is set with a different value,
+        the value of a par is kept when it goes out of scope and into scope again
+        */
+        uint32_t GetVersion() const
+        {
+            return this->m_version;
+        }
+
+        /**
+        return true if none of 'variableIds' has been changed since 'version' returned by GetVersion.
+        a variable bound to a member is taken as changed as the member can be written directly.
+        */
+        bool IsUnchangedSince(uint32_t version, const behaviac::vector<uint32_t>& variableIds) const;
+
         bool IsExisting(uint32_t varId) const
         {
             Variables_t::const_iterator it = this->m_variables.find(varId);
@@ -341,6 +365,7 @@ namespace behaviac
             if (it == this->m_variables.end())
             {
                 VariableTypeType* pVar = BEHAVIAC_NEW VariableTypeType(0, property_, value);
+                pVar->m_version = ++this->m_version;
                 m_variables[varId] = pVar;
 
             }
@@ -438,6 +463,7 @@ namespace behaviac
     protected:
         typedef behaviac::map<uint32_t, IVariable*> Variables_t;
         Variables_t m_variables;
+        uint32_t	m_version;
     public:
         behaviac::map<uint32_t, IVariable*>& Vars()
         {
@@ -148,6 +148,24 @@ namespace behaviac
         {
             return this->m_memberBase;
         }
+
+        bool IsConst() const
+        {
+            return this->m_bIsConst;
+        }
+
+        bool IsVectorElement() const
+        {
+            return this->m_parent != 0;
+        }
+
+        /**
+        return true if it is a property of the agent itself, otherwise its agent is looked up by the instance name
+        */
+        bool IsSelf() const
+        {
+            return this->m_instanceName.empty() || this->m_instanceName == "Self";
+        }
     protected:
         Property(const Property& copy);
         Property(Property* parent, const char* indexStr);
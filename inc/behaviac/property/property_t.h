@@ -92,10 +92,11 @@ namespace behaviac
 
         virtual void SetFrom(Agent* pAgentFrom, const CMethodBase* from, Agent* pAgentTo)
         {
-            ((CMethodBase*)from)->Invoke(pAgentFrom);
+            CMethodBase* pMethod = (CMethodBase*)from;
+            const Agent* pParent = pMethod->GetParentAgent(pAgentFrom);
 
             VariableType retV;
-            ((CMethodBase*)from)->GetReturnValue(pAgentFrom, retV);
+            pMethod->Invoke(pParent, pAgentFrom, retV);
             this->SetValue(pAgentTo, retV);
         }
 
@@ -567,11 +568,27 @@ namespace behaviac
         using TTProperty<behaviac::string, false>::SetFrom;
         virtual void SetFrom(Agent* pAgentFrom, const CMethodBase* from, Agent* pAgentTo)
         {
-            ((CMethodBase*)from)->Invoke(pAgentFrom);
+            CMethodBase* pMethod = (CMethodBase*)from;
+            const Agent* pParent = pMethod->GetParentAgent(pAgentFrom);
 
-            //from->GetReturnValue((const CTagObject*)pAgentFrom, (behaviac::Property*)this, (CTagObject*)pAgentTo)
-            const char* strFrom = from->GetReturnString(pAgentFrom);
-            behaviac::string retV(strFrom);
+            behaviac::string retV;
+
+            if (pMethod->IsReturnType<behaviac::string>())
+            {
+                pMethod->Call(pParent, pAgentFrom, &retV);
+            }
+            else
+            {
+                //the return value of another type is converted through its string
+                behaviac::IAsyncValue* pReturn = pMethod->CreateReturnValue();
+                pMethod->run(pParent, pAgentFrom, pReturn);
+
+                if (pReturn)
+                {
+                    retV = pReturn->GetString();
+                    BEHAVIAC_DELETE(pReturn);
+                }
+            }
 
             this->SetValue(pAgentTo, retV);
         }
@@ -626,12 +643,14 @@ namespace behaviac
     template<typename VariableType, bool bVector>
     void TTProperty<VariableType, bVector>::SetFrom(Agent* pAgentFrom, const CMethodBase* from, Agent* pAgentTo, int index)
     {
-        ((CMethodBase*)from)->Invoke(pAgentFrom);
+        CMethodBase* pMethod = (CMethodBase*)from;
+        const Agent* pParent = pMethod->GetParentAgent(pAgentFrom);
+
+        behaviac::vector<VariableType> retVec;
+        pMethod->Invoke(pParent, pAgentFrom, retVec);
 
-        VariableType retV;
-        ((CMethodBase*)from)->GetReturnValue(pAgentFrom, retV, index);
         TProperty<VariableType>* thisT = (TProperty<VariableType>*)this;
-        thisT->SetValue(pAgentTo, retV);
+        thisT->SetValue(pAgentTo, retVec[index]);
     }
 
     template<typename VariableType, bool bVector>
@@ -838,6 +857,19 @@ const T& ParamVariablePrimitive<T>::GetValue(const CTagObject* parent, const CTa
     return this->param;
 }
 
+template <typename T>
+const T& ParamVariablePrimitive<T>::GetValue(const CTagObject* parent, const CTagObject* parHolder, ParamOutValueStorage_t<T>& storage) const
+{
+    if (this->prop && behaviac::Agent::DynamicCast(parent))
+    {
+        return ParamVariablePrimitiveBase<T>::GetValue(parent, parHolder);
+    }
+
+    storage.value = this->GetValue();
+
+    return storage.value;
+}
+
 BEHAVIAC_FORCEINLINE const char* ParamVariablePrimitive<char*>::GetValue(const CTagObject* parent, const CTagObject* parHolder) const
 {
     if (this->prop && behaviac::Agent::DynamicCast(parent))
@@ -923,7 +955,7 @@ namespace behaviac
 }
 
 template <typename T>
-const T& ParamVariableStruct<T>::GetValue(const CTagObject* parent, const CTagObject* parHolder) const
+const T& ParamVariableStruct<T>::GetValue(const CTagObject* parent, const CTagObject* parHolder, T& storage) const
 {
     if (this->prop && behaviac::Agent::DynamicCast(parent))
     {
@@ -932,20 +964,44 @@ const T& ParamVariableStruct<T>::GetValue(const CTagObject* parent, const CTagOb
         return pT->GetValue((const behaviac::Agent*)parent, (const behaviac::Agent*)parHolder);
     }
 
-    if (this->m_props.size() > 0)
+    if (this->m_members.empty())
     {
-        for (PropsMap_t::const_iterator it = this->m_props.begin();
-             it != this->m_props.end(); ++it)
-        {
-            const CStringID& propId = it->first;
-            const behaviac::Property* pProperty = it->second;
+        return this->param;
+    }
 
-            const CMemberBase* pM = behaviac::GetMemberFromName<T>(propId);
-            pM->SetFromProperty((CTagObject*)&this->param, parHolder, pProperty);
-        }
+    storage = this->param;
+
+    for (typename BoundMembers_t::const_iterator it = this->m_members.begin();
+         it != this->m_members.end(); ++it)
+    {
+        it->member->SetFromProperty((CTagObject*)&storage, parHolder, it->prop);
     }
 
-    return this->param;
+    return storage;
+}
+
+template <typename T>
+void ParamVariableStruct<T>::ResolveMembers()
+{
+    this->m_members.clear();
+    this->m_members.reserve(this->m_props.size());
+
+    for (typename PropsMap_t::iterator it = this->m_props.begin();
+         it != this->m_props.end(); ++it)
+    {
+        const CStringID& propId = it->first;
+
+        BoundMember_t m;
+        m.member = behaviac::GetMemberFromName<T>(propId);
+        m.prop = it->second;
+
+        BEHAVIAC_ASSERT(m.member);
+
+        if (m.member)
+        {
+            this->m_members.push_back(m);
+        }
+    }
 }
 
 template <typename T>
@@ -953,17 +1009,10 @@ void ParamVariableStruct<T>::SetVariableRegistry(const CTagObject* parHolder, co
 {
     if (this->IsRefOut())
     {
-        if (this->m_props.size() > 0)
+        for (typename BoundMembers_t::iterator it = this->m_members.begin();
+             it != this->m_members.end(); ++it)
         {
-            for (PropsMap_t::iterator it = this->m_props.begin();
-                 it != this->m_props.end(); ++it)
-            {
-                const CStringID& propId = it->first;
-                behaviac::Property* pProperty = it->second;
-
-                const CMemberBase* pM = behaviac::GetMemberFromName<T>(propId);
-                pProperty->SetFrom((behaviac::Agent*)&this->param, pM, (behaviac::Agent*)parHolder);
-            }
+            it->prop->SetFrom((behaviac::Agent*)&value, it->member, (behaviac::Agent*)parHolder);
         }
 
         if (this->prop && behaviac::Agent::DynamicCast(parHolder))
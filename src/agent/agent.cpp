@@ -22,6 +22,7 @@
 #include "behaviac/base/object/method.h"
 #include "behaviac/behaviortree/behaviortree.h"
 #include "behaviac/behaviortree/behaviortree_task.h"
+#include "behaviac/behaviortree/attachments/event.h"
 
 #include "behaviac/base/core/profiler/profiler.h"
 #include "behaviac/htn/agentproperties.h"
@@ -195,6 +196,8 @@ namespace behaviac
 
         this->m_behaviorTreeTasks.clear();
 
+        this->ClearEventListeners();
+
         for (AgentEvents_t::iterator it = this->m_eventInfos.begin(); it != this->m_eventInfos.end(); ++it)
         {
             CNamedEvent* p = it->second;
@@ -961,14 +964,178 @@ namespace behaviac
         return BT_INVALID;
     }
 
+    struct EventListenerDepth_t
+    {
+        BehaviorTask*	task;
+        uint32_t		eventIndex;
+        uint32_t		depth;
+    };
+
+    static bool IsDeeperListener(const EventListenerDepth_t& a, const EventListenerDepth_t& b)
+    {
+        return a.depth > b.depth;
+    }
+
     void Agent::btonevent(const char* btEvent)
     {
         if (this->m_currentBT)
         {
-            this->m_currentBT->onevent(this, btEvent);
+            this->m_currentBT->RestoreEventListeners(this);
+
+            CStringID eventId(btEvent);
+            EventListeners_t::iterator it = this->m_eventListeners.find(eventId);
+
+            if (it == this->m_eventListeners.end())
+            {
+                return;
+            }
+
+            //only the tasks of the current tree handle it, the tasks of the paused trees and the subtrees are skipped as before.
+            //they are copied out as switching to the event's tree enters and exits tasks
+            behaviac::vector<EventListenerDepth_t> listeners;
+            listeners.reserve(it->second.size());
+
+            for (uint32_t i = 0; i < it->second.size(); ++i)
+            {
+                EventListenerDepth_t listener;
+                listener.task = it->second[i].task;
+                listener.eventIndex = it->second[i].eventIndex;
+                listener.depth = 0;
+
+                const BehaviorTask* pRoot = listener.task;
+
+                while (pRoot->GetParent() != 0)
+                {
+                    pRoot = pRoot->GetParent();
+                    listener.depth++;
+                }
+
+                if (pRoot == this->m_currentBT)
+                {
+                    listeners.push_back(listener);
+                }
+            }
+
+            //the innermost task first, then its ancestors, as the running branch used to be walked up
+            std::stable_sort(listeners.begin(), listeners.end(), IsDeeperListener);
+
+            for (uint32_t i = 0; i < listeners.size(); ++i)
+            {
+                const EventListenerDepth_t& listener = listeners[i];
+
+                if (!this->IsEventListener(eventId, listener.task, listener.eventIndex))
+                {
+                    //it is exited by the tree switched to by the previous one
+                    continue;
+                }
+
+                Event* pE = (Event*)listener.task->m_node->m_events[listener.eventIndex];
+                pE->switchTo(this);
+
+                if (pE->TriggeredOnce())
+                {
+                    break;
+                }
+            }
         }
     }
 
+    bool Agent::HasEventListeners(const CStringID& eventId) const
+    {
+        return this->m_eventListeners.find(eventId) != this->m_eventListeners.end();
+    }
+
+    bool Agent::IsEventListener(const CStringID& eventId, const BehaviorTask* pTask, uint32_t eventIndex) const
+    {
+        EventListeners_t::const_iterator it = this->m_eventListeners.find(eventId);
+
+        if (it != this->m_eventListeners.end())
+        {
+            const EventListenerTasks_t& tasks = it->second;
+
+            for (uint32_t i = 0; i < tasks.size(); ++i)
+            {
+                if (tasks[i].task == pTask && tasks[i].eventIndex == eventIndex)
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void Agent::AddEventListener(const CStringID& eventId, BehaviorTask* pTask, uint32_t eventIndex)
+    {
+        EventListeners_t::iterator it = this->m_eventListeners.find(eventId);
+
+        if (it == this->m_eventListeners.end())
+        {
+            Context& c = Context::GetContext(this->GetContextId());
+            c.AddEventListener(eventId, this);
+
+            it = this->m_eventListeners.insert(std::make_pair(eventId, EventListenerTasks_t())).first;
+        }
+
+        EventListener_t listener;
+        listener.task = pTask;
+        listener.eventIndex = eventIndex;
+
+        it->second.push_back(listener);
+    }
+
+    void Agent::RemoveEventListener(BehaviorTask* pTask)
+    {
+        for (EventListeners_t::iterator it = this->m_eventListeners.begin(); it != this->m_eventListeners.end();)
+        {
+            EventListenerTasks_t& tasks = it->second;
+
+            for (uint32_t i = 0; i < tasks.size();)
+            {
+                if (tasks[i].task == pTask)
+                {
+                    tasks.erase(tasks.begin() + i);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+
+            if (tasks.empty())
+            {
+                Context& c = Context::GetContext(this->GetContextId());
+                c.RemoveEventListener(it->first, this);
+
+                this->m_eventListeners.erase(it++);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void Agent::ClearEventListeners()
+    {
+        Context& c = Context::GetContext(this->GetContextId());
+
+        for (EventListeners_t::iterator it = this->m_eventListeners.begin(); it != this->m_eventListeners.end(); ++it)
+        {
+            //the tasks not destroyed with the agent should not access it any more
+            EventListenerTasks_t& tasks = it->second;
+
+            for (uint32_t i = 0; i < tasks.size(); ++i)
+            {
+                tasks[i].task->m_eventAgent = 0;
+            }
+
+            c.RemoveEventListener(it->first, this);
+        }
+
+        this->m_eventListeners.clear();
+    }
+
     BehaviorTreeTask* Agent::btgetcurrent()
     {
         return m_currentBT;
@@ -1554,8 +1721,7 @@ namespace behaviac
         {
             Workspace::GetInstance()->DestroyBehaviorTreeTask(state.m_bt, this);
 
-            const BehaviorNode* pNode = this->m_currentBT->GetNode();
-            state.m_bt = (BehaviorTreeTask*)pNode->CreateAndInitTask();
+            state.m_bt = Workspace::GetInstance()->CreateBehaviorTreeTask(this->m_currentBT->GetName().c_str());
             this->m_currentBT->CopyTo(state.m_bt);
 
             return true;
@@ -1589,9 +1755,10 @@ namespace behaviac
                 }
             }
 
-            const BehaviorNode* pNode = state.m_bt->GetNode();
-            this->m_currentBT = (BehaviorTreeTask*)pNode->CreateAndInitTask();
+            this->m_currentBT = Workspace::GetInstance()->CreateBehaviorTreeTask(state.m_bt->GetName().c_str());
+            this->m_behaviorTreeTasks.push_back(this->m_currentBT);
             state.m_bt->CopyTo(this->m_currentBT);
+            this->m_currentBT->RestoreEventListeners(this);
 
             return true;
         }
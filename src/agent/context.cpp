@@ -16,14 +16,18 @@
 #include "behaviac/agent/state.h"
 
 #include "behaviac/base/core/thread/mutex.h"
+#include "behaviac/base/core/thread/wrapper.h"
 
 #include "behaviac/base/file/filesystem.h"
+#include "behaviac/base/workspace.h"
 
 namespace behaviac
 {
     Context::Contexts_t* Context::ms_contexts;
+    behaviac::Mutex Context::ms_contextsCs;
 
-    Context::Context(int contextId) : m_context_id(contextId), m_bCreatedByMe(false)
+    Context::Context(int contextId) : m_postedEvents(0), m_context_id(contextId), m_bCreatedByMe(false),
+        m_bOwnClock(false), m_timeSinceStartup(0.0f), m_deltaTime(0.0f), m_deltaFrames(0)
     {
     }
 
@@ -37,6 +41,15 @@ namespace behaviac
         this->CleanupStaticVariables();
         this->CleanupInstances();
 
+        for (DeferredEvent* pEvent = this->m_postedEvents; pEvent != 0;)
+        {
+            DeferredEvent* pNext = pEvent->m_next;
+            BEHAVIAC_DELETE(pEvent);
+            pEvent = pNext;
+        }
+
+        this->m_postedEvents = 0;
+
         {
             for (AgentStaticEvents_t::iterator it = ms_eventInfosGlobal.begin(); it != ms_eventInfosGlobal.end(); ++it)
             {
@@ -54,18 +67,24 @@ namespace behaviac
     }
     Context& Context::GetContext(int contextId)
     {
-        if (!ms_contexts)
+        BEHAVIAC_ASSERT(contextId >= 0);
+
+        if (ms_contexts)
         {
-            ms_contexts = BEHAVIAC_NEW Contexts_t;
+            Contexts_t::iterator it = ms_contexts->find(contextId);
+
+            if (it != ms_contexts->end())
+            {
+                Context* pContext = it->second;
+                return *pContext;
+            }
         }
 
-        BEHAVIAC_ASSERT(contextId >= 0);
-        Contexts_t::iterator it = ms_contexts->find(contextId);
+        behaviac::ScopedLock lock(ms_contextsCs);
 
-        if (it != ms_contexts->end())
+        if (!ms_contexts)
         {
-            Context* pContext = it->second;
-            return *pContext;
+            ms_contexts = BEHAVIAC_NEW Contexts_t;
         }
 
         Context* pContext = BEHAVIAC_NEW Context(contextId);
@@ -74,8 +93,94 @@ namespace behaviac
         return *pContext;
     }
 
+    Context* Context::FindContext(int contextId)
+    {
+        behaviac::ScopedLock lock(ms_contextsCs);
+
+        if (ms_contexts)
+        {
+            Contexts_t::iterator it = ms_contexts->find(contextId);
+
+            if (it != ms_contexts->end())
+            {
+                return it->second;
+            }
+        }
+
+        return 0;
+    }
+
+    void Context::UseOwnClock()
+    {
+        if (!this->m_bOwnClock)
+        {
+            //the values not set yet keep following the workspace's ones
+            Workspace* pWorkspace = Workspace::GetInstance();
+            this->m_timeSinceStartup = pWorkspace->GetTimeSinceStartup();
+            this->m_deltaTime = pWorkspace->GetDeltaFrameTime();
+            this->m_deltaFrames = pWorkspace->GetDeltaFrames();
+
+            this->m_bOwnClock = true;
+        }
+    }
+
+    void Context::SetTimeSinceStartup(float timeSinceStartup)
+    {
+        this->UseOwnClock();
+        this->m_timeSinceStartup = timeSinceStartup;
+    }
+
+    float Context::GetTimeSinceStartup() const
+    {
+        return this->m_bOwnClock ? this->m_timeSinceStartup : Workspace::GetInstance()->GetTimeSinceStartup();
+    }
+
+    void Context::SetDeltaFrameTime(float deltaTime)
+    {
+        this->UseOwnClock();
+        this->m_deltaTime = deltaTime;
+    }
+
+    float Context::GetDeltaFrameTime() const
+    {
+        return this->m_bOwnClock ? this->m_deltaTime : Workspace::GetInstance()->GetDeltaFrameTime();
+    }
+
+    void Context::SetDeltaFrames(int deltaFrames)
+    {
+        this->UseOwnClock();
+        this->m_deltaFrames = deltaFrames;
+    }
+
+    int Context::GetDeltaFrames() const
+    {
+        return this->m_bOwnClock ? this->m_deltaFrames : Workspace::GetInstance()->GetDeltaFrames();
+    }
+
+    int Context::UpdateActionCount(const char* actionString)
+    {
+        CStringID actionId(actionString);
+
+        return ++this->m_actions_count[actionId];
+    }
+
+    int Context::GetActionCount(const char* actionString) const
+    {
+        CStringID actionId(actionString);
+        ActionCount_t::const_iterator it = this->m_actions_count.find(actionId);
+
+        if (it != this->m_actions_count.end())
+        {
+            return it->second;
+        }
+
+        return 0;
+    }
+
     void Context::Cleanup(int contextId)
     {
+        behaviac::ScopedLock lock(ms_contextsCs);
+
         if (ms_contexts)
         {
             if (contextId == -1)
@@ -336,6 +441,182 @@ namespace behaviac
         }
     }
 
+    void Context::AddEventListener(const CStringID& eventId, Agent* pAgent)
+    {
+        this->m_eventListeners[eventId][pAgent->GetId()] = pAgent;
+    }
+
+    void Context::RemoveEventListener(const CStringID& eventId, Agent* pAgent)
+    {
+        EventListeners_t::iterator it = this->m_eventListeners.find(eventId);
+
+        if (it != this->m_eventListeners.end())
+        {
+            Agents_t& agents = it->second;
+            agents.erase(pAgent->GetId());
+
+            if (agents.empty())
+            {
+                this->m_eventListeners.erase(it);
+            }
+        }
+    }
+
+    void Context::GetEventListeners(const char* eventName, behaviac::vector<Agent*>& listeners) const
+    {
+        CStringID eventId(eventName);
+        EventListeners_t::const_iterator it = this->m_eventListeners.find(eventId);
+
+        if (it != this->m_eventListeners.end())
+        {
+            const Agents_t& agents = it->second;
+            listeners.reserve(listeners.size() + agents.size());
+
+            for (Agents_t::const_iterator ita = agents.begin(); ita != agents.end(); ++ita)
+            {
+                listeners.push_back(ita->second);
+            }
+        }
+    }
+
+    void Context::PostEvent(DeferredEvent* pEvent)
+    {
+        BEHAVIAC_ASSERT(pEvent);
+
+        void* volatile& head = (void* volatile&)this->m_postedEvents;
+
+        for (;;)
+        {
+            DeferredEvent* pHead = this->m_postedEvents;
+            pEvent->m_next = pHead;
+
+            if (AtomicCompareExchangePointer(head, pEvent, pHead) == pHead)
+            {
+                break;
+            }
+        }
+    }
+
+    void Context::PostEvent(int contextId, DeferredEvent* pEvent)
+    {
+        Context* pContext = Context::FindContext(contextId);
+
+        if (pContext)
+        {
+            pContext->PostEvent(pEvent);
+        }
+        else
+        {
+            //not an error, it might be posted from another thread after the context was cleaned up
+            BEHAVIAC_LOGWARNING("the context %d doesn't exist, the posted event is dropped\n", contextId);
+            BEHAVIAC_DELETE(pEvent);
+        }
+    }
+
+    Agent* Context::FindAgent(int agentId)
+    {
+        for (uint32_t i = 0; i < this->m_agents.size(); ++i)
+        {
+            Agents_t& agents = this->m_agents[i].agents;
+            Agents_t::iterator it = agents.find(agentId);
+
+            if (it != agents.end())
+            {
+                return it->second;
+            }
+        }
+
+        return 0;
+    }
+
+    struct DeferredEventCompare_t
+    {
+        bool operator()(const DeferredEvent* lhs, const DeferredEvent* rhs) const
+        {
+            return lhs->GetAgentId() < rhs->GetAgentId();
+        }
+    };
+
+    void Context::execEvents(int contextId)
+    {
+        if (contextId >= 0)
+        {
+            Context& pContext = Context::GetContext(contextId);
+
+            pContext.execEvents_();
+        }
+        else if (ms_contexts)
+        {
+            for (Contexts_t::iterator it = ms_contexts->begin(); it != ms_contexts->end(); ++it)
+            {
+                Context* pContext = it->second;
+                pContext->execEvents_();
+            }
+        }
+    }
+
+    void Context::execEvents_()
+    {
+        ASSERT_MAIN_THREAD();
+
+        if (this->m_postedEvents == 0)
+        {
+            return;
+        }
+
+        //take the whole list, the events posted when firing these are kept for the next time
+        void* volatile& head = (void* volatile&)this->m_postedEvents;
+        DeferredEvent* pList = this->m_postedEvents;
+
+        for (;;)
+        {
+            DeferredEvent* pHead = (DeferredEvent*)AtomicCompareExchangePointer(head, 0, pList);
+
+            if (pHead == pList)
+            {
+                break;
+            }
+
+            pList = pHead;
+        }
+
+        for (DeferredEvent* pEvent = pList; pEvent != 0; pEvent = pEvent->m_next)
+        {
+            this->m_firingEvents.push_back(pEvent);
+        }
+
+        //the list is in the reverse posting order
+        std::reverse(this->m_firingEvents.begin(), this->m_firingEvents.end());
+
+        //stable to keep the order the events are posted to the same agent
+        std::stable_sort(this->m_firingEvents.begin(), this->m_firingEvents.end(), DeferredEventCompare_t());
+
+        Agent* pAgent = 0;
+        int agentId = -1;
+
+        for (uint32_t i = 0; i < this->m_firingEvents.size(); ++i)
+        {
+            DeferredEvent* pEvent = this->m_firingEvents[i];
+
+            if (i == 0 || pEvent->GetAgentId() != agentId)
+            {
+                agentId = pEvent->GetAgentId();
+
+                //the agent might have been destroyed since the event was posted
+                pAgent = this->FindAgent(agentId);
+            }
+
+            if (pAgent)
+            {
+                pEvent->Fire(pAgent);
+            }
+
+            BEHAVIAC_DELETE(pEvent);
+        }
+
+        this->m_firingEvents.clear();
+    }
+
     void Context::execAgents(int contextId)
     {
         if (contextId >= 0)
@@ -35,10 +35,12 @@ namespace behaviac
     {
         c.m_vars.CopyTo(0, this->m_vars);
 
+        Workspace::GetInstance()->DestroyBehaviorTreeTask(this->m_bt, 0);
+        this->m_bt = 0;
+
         if (c.m_bt)
         {
-            const BehaviorNode* pNode = c.m_bt->GetNode();
-            this->m_bt = (BehaviorTreeTask*)pNode->CreateAndInitTask();
+            this->m_bt = Workspace::GetInstance()->CreateBehaviorTreeTask(c.m_bt->GetName().c_str());
 
             c.m_bt->CopyTo(this->m_bt);
         }
@@ -50,7 +52,8 @@ namespace behaviac
     {
         this->m_vars.Clear();
 
-        BEHAVIAC_DELETE(this->m_bt);
+        //the tasks are created by the workspace, which keeps the number of the live tasks of each tree
+        Workspace::GetInstance()->DestroyBehaviorTreeTask(this->m_bt, 0);
         this->m_bt = 0;
     }
 
@@ -100,7 +103,7 @@ namespace behaviac
 
             if (btNode->getAttr(sourceId, btName))
             {
-                BEHAVIAC_DELETE this->m_bt;
+                Workspace::GetInstance()->DestroyBehaviorTreeTask(this->m_bt, 0);
                 this->m_bt = Workspace::GetInstance()->CreateBehaviorTreeTask(btName.c_str());
             }
 
@@ -44,9 +44,6 @@ namespace behaviac
         void ShutdownConnection();
     }
 
-
-    void CleanupTickingMutex();
-
     static int ms_nStarted = 0;
 
     bool IsStarted()
@@ -107,8 +104,6 @@ namespace behaviac
 
             BehaviorNode::Cleanup();
 
-            CleanupTickingMutex();
-
             //Agent::Cleanup();
             //Variables::Cleanup();
             Property::Cleanup();
@@ -0,0 +1,271 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tencent is pleased to support the open source community by making behaviac available.
+//
+// Copyright (C) 2015 THL A29 Limited, a Tencent company. All rights reserved.
+//
+// Licensed under the BSD 3-Clause License (the "License"); you may not use this file except in compliance with
+// the License. You may obtain a copy of the License at http://opensource.org/licenses/BSD-3-Clause
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and limitations under the License.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "behaviac/base/base.h"
+#include "behaviac/base/core/assert_t.h"
+
+#include "behaviac/base/core/lz.h"
+
+namespace LZ
+{
+    static const uint32_t kMinMatch = 4;
+    static const uint32_t kMaxOffset = 0xffff;
+    static const uint32_t kHashLog = 12;
+
+    static inline uint32_t Read32(const uint8_t* p)
+    {
+        uint32_t v;
+        memcpy(&v, p, sizeof(v));
+
+        return v;
+    }
+
+    static inline uint32_t Hash(uint32_t sequence)
+    {
+        return (sequence * 2654435761U) >> (32 - kHashLog);
+    }
+
+    //the lengths not less than 15 are continued by the bytes of 255 and the last byte less than 255
+    static inline bool WriteLength(uint8_t*& op, const uint8_t* oend, uint32_t length)
+    {
+        for (; length >= 255; length -= 255)
+        {
+            if (op >= oend)
+            {
+                return false;
+            }
+
+            *op++ = 255;
+        }
+
+        if (op >= oend)
+        {
+            return false;
+        }
+
+        *op++ = (uint8_t)length;
+
+        return true;
+    }
+
+    static inline bool ReadLength(const uint8_t*& ip, const uint8_t* iend, uint32_t& length)
+    {
+        uint8_t b = 255;
+
+        while (b == 255)
+        {
+            if (ip >= iend)
+            {
+                return false;
+            }
+
+            b = *ip++;
+            length += b;
+        }
+
+        return true;
+    }
+
+    static bool WriteSequence(uint8_t*& op, const uint8_t* oend, const uint8_t* literals, uint32_t literalLength, uint32_t offset, uint32_t matchLength)
+    {
+        if (op >= oend)
+        {
+            return false;
+        }
+
+        uint8_t* token = op++;
+        *token = (uint8_t)((literalLength < 15 ? literalLength : 15) << 4);
+
+        if (literalLength >= 15 && !WriteLength(op, oend, literalLength - 15))
+        {
+            return false;
+        }
+
+        if (op + literalLength > oend)
+        {
+            return false;
+        }
+
+        memcpy(op, literals, literalLength);
+        op += literalLength;
+
+        //the last sequence has no match
+        if (matchLength == 0)
+        {
+            return true;
+        }
+
+        if (op + 2 > oend)
+        {
+            return false;
+        }
+
+        *op++ = (uint8_t)(offset & 0xff);
+        *op++ = (uint8_t)(offset >> 8);
+
+        matchLength -= kMinMatch;
+        *token |= (uint8_t)(matchLength < 15 ? matchLength : 15);
+
+        if (matchLength >= 15 && !WriteLength(op, oend, matchLength - 15))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    uint32_t CompressBound(uint32_t size)
+    {
+        return size + size / 255 + 16;
+    }
+
+    uint32_t Compress(const char* src, uint32_t srcSize, char* dst, uint32_t dstCapacity)
+    {
+        const uint8_t* base = (const uint8_t*)src;
+        const uint8_t* ip = base;
+        const uint8_t* anchor = base;
+        const uint8_t* iend = base + srcSize;
+
+        uint8_t* op = (uint8_t*)dst;
+        const uint8_t* oend = op + dstCapacity;
+
+        //the positions plus 1 of the last sequences of the same hash, 0 for none
+        uint32_t table[1 << kHashLog];
+        memset(table, 0, sizeof(table));
+
+        if (srcSize > kMinMatch)
+        {
+            const uint8_t* matchLimit = iend - kMinMatch;
+
+            while (ip <= matchLimit)
+            {
+                uint32_t sequence = Read32(ip);
+                uint32_t h = Hash(sequence);
+                uint32_t position = (uint32_t)(ip - base);
+                uint32_t candidate = table[h];
+                table[h] = position + 1;
+
+                if (candidate != 0 && position + 1 - candidate <= kMaxOffset && Read32(base + candidate - 1) == sequence)
+                {
+                    const uint8_t* match = base + candidate - 1;
+                    uint32_t matchLength = kMinMatch;
+
+                    while (ip + matchLength < iend && match[matchLength] == ip[matchLength])
+                    {
+                        matchLength++;
+                    }
+
+                    if (!WriteSequence(op, oend, anchor, (uint32_t)(ip - anchor), (uint32_t)(ip - match), matchLength))
+                    {
+                        return 0;
+                    }
+
+                    ip += matchLength;
+                    anchor = ip;
+                }
+                else
+                {
+                    ip++;
+                }
+            }
+        }
+
+        if (!WriteSequence(op, oend, anchor, (uint32_t)(iend - anchor), 0, 0))
+        {
+            return 0;
+        }
+
+        return (uint32_t)(op - (uint8_t*)dst);
+    }
+
+    bool Decompress(const char* src, uint32_t srcSize, char* dst, uint32_t dstSize)
+    {
+        const uint8_t* ip = (const uint8_t*)src;
+        const uint8_t* iend = ip + srcSize;
+
+        uint8_t* op = (uint8_t*)dst;
+        uint8_t* oend = op + dstSize;
+
+        while (ip < iend)
+        {
+            uint8_t token = *ip++;
+
+            uint32_t literalLength = token >> 4;
+
+            if (literalLength == 15 && !ReadLength(ip, iend, literalLength))
+            {
+                return false;
+            }
+
+            if (literalLength > (uint32_t)(iend - ip) || literalLength > (uint32_t)(oend - op))
+            {
+                return false;
+            }
+
+            memcpy(op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+
+            if (ip == iend)
+            {
+                break;
+            }
+
+            if (ip + 2 > iend)
+            {
+                return false;
+            }
+
+            uint32_t offset = ip[0] | (ip[1] << 8);
+            ip += 2;
+
+            if (offset == 0 || offset > (uint32_t)(op - (uint8_t*)dst))
+            {
+                return false;
+            }
+
+            uint32_t matchLength = token & 15;
+
+            if (matchLength == 15 && !ReadLength(ip, iend, matchLength))
+            {
+                return false;
+            }
+
+            matchLength += kMinMatch;
+
+            if (matchLength > (uint32_t)(oend - op))
+            {
+                return false;
+            }
+
+            const uint8_t* match = op - offset;
+
+            if (offset >= matchLength)
+            {
+                memcpy(op, match, matchLength);
+                op += matchLength;
+            }
+            else
+            {
+                //the overlapped match repeats the last 'offset' bytes
+                for (uint32_t i = 0; i < matchLength; ++i)
+                {
+                    *op++ = match[i];
+                }
+            }
+        }
+
+        return op == oend;
+    }
+}
@@ -41,8 +41,24 @@ namespace behaviac
         delete gs_threadInt;
         gs_threadInt = 0;
     }
+
+    //the bytes allocated minus the bytes freed by the current thread
+#if BEHAVIAC_COMPILER_MSVC
+    static __declspec(thread) int64_t t_threadAllocatedSize;
+#else
+    static __thread int64_t t_threadAllocatedSize;
+#endif
 #endif//BEHAVIAC_DEBUG_MEMORY_STATS
 
+    int64_t GetThreadAllocatedSize()
+    {
+#if BEHAVIAC_DEBUG_MEMORY_STATS
+        return t_threadAllocatedSize;
+#else
+        return 0;
+#endif
+    }
+
     ///Default Allocator used internally in Tag.   It can also be used externally using behaviac::GetDefaultMemoryAllocator();
     class MemDefaultAllocator : public IMemAllocator
     {
@@ -463,11 +479,12 @@ namespace behaviac
             }
 
             m_allocated_size += bytes;
-
+            t_threadAllocatedSize += bytes;
         }
         else
         {
             m_allocated_size += (bytes - *pSize);
+            t_threadAllocatedSize += (int64_t)bytes - (int64_t)*pSize;
 
             *pSize = bytes;
         }
@@ -490,6 +507,7 @@ namespace behaviac
         }
 
         m_allocated_size -= bytes;
+        t_threadAllocatedSize -= bytes;
     }
 
     size_t PtrSizeRegister_::GetAllocatedSize() const
@@ -44,6 +44,11 @@ namespace behaviac
         return i;
     }
 
+    void* AtomicCompareExchangePointer(void* volatile& p, void* v, void* comparand)
+    {
+        return __sync_val_compare_and_swap(&p, comparand, v);
+    }
+
     void ThreadInt::Init()
     {
         if (!m_inited)
@@ -37,5 +37,10 @@ namespace behaviac
     {
         return InterlockedDecrement(reinterpret_cast<volatile long*>(&i));
     }
+
+    void* AtomicCompareExchangePointer(void* volatile& p, void* v, void* comparand)
+    {
+        return InterlockedCompareExchangePointer(&p, v, comparand);
+    }
 }
 #endif//#if BEHAVIAC_COMPILER_MSVC
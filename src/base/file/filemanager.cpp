@@ -138,6 +138,16 @@ uint64_t CFileManager::FileGetSize(const char* fileName)
     return fileSize;
 }
 
+const char* CFileManager::FileMap(const char* fileName, uint32_t& fileSize)
+{
+    return CFileSystem::MapFile(fileName, fileSize);
+}
+
+void CFileManager::FileUnmap(const char* pData, uint32_t fileSize)
+{
+    CFileSystem::UnmapFile(pData, fileSize);
+}
+
 //
 bool CFileManager::PathIsRelative(const behaviac::string& path)
 {
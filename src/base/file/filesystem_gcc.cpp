@@ -35,6 +35,8 @@
 #include <fcntl.h>
 #include <deque>
 #include <pthread.h>
+#include <sys/mman.h>
+#include <fnmatch.h>
 #endif
 
 #if BEHAVIAC_COMPILER_ANDROID && (BEHAVIAC_COMPILER_ANDROID_VER > 8)
@@ -233,6 +235,59 @@ uint64_t CFileSystem::GetFileSize(Handle hFile)
 #endif
 }
 
+const char* CFileSystem::MapFile(const char* szFullPath, uint32_t& fileSize)
+{
+    fileSize = 0;
+
+#if (BEHAVIAC_COMPILER_ANDROID && (BEHAVIAC_COMPILER_ANDROID_VER > 8)) || BEHAVIAC_COMPILER_GCC_CYGWIN
+    BEHAVIAC_UNUSED_VAR(szFullPath);
+
+    return 0;
+#else
+    int fd = open(szFullPath, O_RDONLY);
+
+    if (fd == -1)
+    {
+        return 0;
+    }
+
+    struct stat buf;
+    void* pData = MAP_FAILED;
+
+    if (fstat(fd, &buf) == 0 && buf.st_size > 0)
+    {
+        pData = mmap(0, (size_t)buf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+
+    //the mapping is still valid after the file is closed
+    close(fd);
+
+    if (pData == MAP_FAILED)
+    {
+        return 0;
+    }
+
+    fileSize = (uint32_t)buf.st_size;
+
+    return (const char*)pData;
+#endif
+}
+
+void CFileSystem::UnmapFile(const char* pData, uint32_t fileSize)
+{
+#if (BEHAVIAC_COMPILER_ANDROID && (BEHAVIAC_COMPILER_ANDROID_VER > 8)) || BEHAVIAC_COMPILER_GCC_CYGWIN
+    BEHAVIAC_UNUSED_VAR(pData);
+    BEHAVIAC_UNUSED_VAR(fileSize);
+#else
+
+    if (pData)
+    {
+        munmap((void*)pData, fileSize);
+    }
+
+#endif
+}
+
 bool CFileSystem::Delete(const char* szPath, bool bRecursive)
 {
     BEHAVIAC_UNUSED_VAR(bRecursive);
@@ -267,7 +322,7 @@ void CFileSystem::MakeSureDirectoryExist(const char* filename)
         {
             char c = *iter;
             *iter = 0;
-            mkdir(directory, S_IWUSR);
+            mkdir(directory, S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
             *iter = c;
         }
 
@@ -297,6 +352,7 @@ static bool VisitHelper
     behaviac::string&               tempString
 )
 {
+#if BEHAVIAC_COMPILER_GCC_CYGWIN
     BEHAVIAC_UNUSED_VAR(visitor);
     BEHAVIAC_UNUSED_VAR(dir);
     BEHAVIAC_UNUSED_VAR(filter);
@@ -307,6 +363,96 @@ static bool VisitHelper
 
     BEHAVIAC_ASSERT(0);
     return false;
+#else
+    behaviac::string dirA;
+    behaviac::StringUtils::Wide2Char(dirA, dir);
+    behaviac::string filterA;
+    behaviac::StringUtils::Wide2Char(filterA, filter);
+
+    DIR* pDir = opendir(dirA.empty() ? "." : dirA.c_str());
+
+    if (!pDir)
+    {
+        return true;
+    }
+
+    const int dirLength = dirA.size();
+    behaviac::vector<behaviac::string> subDirs;
+    bool cont = true;
+
+    while (cont)
+    {
+        struct dirent* pEntry = readdir(pDir);
+
+        if (!pEntry)
+        {
+            break;
+        }
+
+        if (pEntry->d_name[0] == '.')
+        {
+            continue;
+        }
+
+        tempString = dirA + pEntry->d_name;
+
+        struct stat buf;
+
+        if (stat(tempString.c_str(), &buf) != 0)
+        {
+            continue;
+        }
+
+        bool bIsDirectory = S_ISDIR(buf.st_mode);
+
+        if (bIsDirectory && recursive)
+        {
+            subDirs.push_back(pEntry->d_name);
+        }
+
+        if (fnmatch(filterA.c_str(), pEntry->d_name, 0) != 0)
+        {
+            continue;
+        }
+
+        if (bIsDirectory)
+        {
+            if (visitDirectories)
+            {
+                cont = visitor.VisitDirectory(tempString.c_str(), tempString.c_str() + dirLength);
+            }
+        }
+        else if (visitFiles)
+        {
+            cont = visitor.VisitFile(tempString.c_str(), tempString.c_str() + dirLength);
+        }
+    }
+
+    closedir(pDir);
+
+    for (uint32_t i = 0; cont && i < subDirs.size(); ++i)
+    {
+        tempString = dirA + subDirs[i];
+
+        if (visitor.EnterDirectory(tempString.c_str(), tempString.c_str() + dirLength))
+        {
+            const int dirLengthW = dir.size();
+            behaviac::wstring subDir;
+            behaviac::StringUtils::Char2Wide(subDir, subDirs[i]);
+            dir += subDir;
+            dir += L'/';
+            cont = VisitHelper(visitor, dir, filter, visitFiles, visitDirectories, true, tempString);
+            dir.resize(dirLengthW);
+            visitor.ExitDirectory();
+        }
+        else
+        {
+            cont = false;
+        }
+    }
+
+    return cont;
+#endif//BEHAVIAC_COMPILER_GCC_CYGWIN
 }
 
 void CFileSystem::Visit
@@ -319,11 +465,10 @@ void CFileSystem::Visit
 )
 {
     BEHAVIAC_ASSERT(pathWithFilter);
-    BEHAVIAC_ASSERT(!strchr(pathWithFilter, '/'));
     behaviac::wstring dir;
     behaviac::StringUtils::Char2Wide(dir, pathWithFilter);
     behaviac::wstring filter;
-    behaviac::wstring::size_type lastSeparatorPos = dir.find_last_of(L"\\:");
+    behaviac::wstring::size_type lastSeparatorPos = dir.find_last_of(L"/\\");
 
     if (lastSeparatorPos == behaviac::wstring::npos)
     {
@@ -198,6 +198,56 @@ uint64_t CFileSystem::GetFileSize(Handle hFile)
     return sizeOfFile.QuadPart;
 }
 
+const char* CFileSystem::MapFile(const char* szFullPath, uint32_t& fileSize)
+{
+    fileSize = 0;
+
+    HANDLE hFile = ::CreateFileW(STRING2WSTRING(szFullPath).c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return 0;
+    }
+
+    LARGE_INTEGER sizeOfFile;
+    sizeOfFile.QuadPart = 0ll;
+    ::GetFileSizeEx(hFile, &sizeOfFile);
+
+    const char* pData = 0;
+
+    if (sizeOfFile.QuadPart > 0)
+    {
+        HANDLE hMapping = ::CreateFileMappingW(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+
+        if (hMapping)
+        {
+            pData = (const char*)::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+
+            //the view keeps the mapping object alive
+            ::CloseHandle(hMapping);
+        }
+    }
+
+    ::CloseHandle(hFile);
+
+    if (pData)
+    {
+        fileSize = (uint32_t)sizeOfFile.QuadPart;
+    }
+
+    return pData;
+}
+
+void CFileSystem::UnmapFile(const char* pData, uint32_t fileSize)
+{
+    BEHAVIAC_UNUSED_VAR(fileSize);
+
+    if (pData)
+    {
+        ::UnmapViewOfFile(pData);
+    }
+}
+
 bool CFileSystem::Delete(const char* szPath, bool bRecursive)
 {
     bool success = true;
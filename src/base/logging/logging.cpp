@@ -193,7 +193,7 @@ namespace behaviac
                     if (mode == behaviac::ELM_continue)
                     {
                         //[continue]Ship::Ship_1 ships\suicide.xml->BehaviorTreeTask[0]:enter [all/success/failure] [1]
-                        int count = Workspace::GetInstance()->GetActionCount(btMsg);
+                        int count = Workspace::GetInstance()->GetActionCount(pAgent, btMsg);
                         BEHAVIAC_ASSERT(count > 0);
                         behaviac::string buffer = FormatString("[continue]%s %s [%s] [%d]\n", agentName.c_str(), btMsg, actionResultStr, count);
 
@@ -204,7 +204,7 @@ namespace behaviac
                     else if (mode == behaviac::ELM_breaked)
                     {
                         //[breaked]Ship::Ship_1 ships\suicide.xml->BehaviorTreeTask[0]:enter [all/success/failure] [1]
-                        int count = Workspace::GetInstance()->GetActionCount(btMsg);
+                        int count = Workspace::GetInstance()->GetActionCount(pAgent, btMsg);
                         BEHAVIAC_ASSERT(count > 0);
                         behaviac::string buffer = FormatString("[breaked]%s %s [%s] [%d]\n", agentName.c_str(), btMsg, actionResultStr, count);
 
@@ -218,7 +218,7 @@ namespace behaviac
                         //[tick]Ship::Ship_1 ships\suicide.xml->BehaviorTreeTask[0]:update [1]
                         //[tick]Ship::Ship_1 ships\suicide.xml->Selector[1]:enter [all/success/failure] [1]
                         //[tick]Ship::Ship_1 ships\suicide.xml->Selector[1]:update [1]
-                        int count = Workspace::GetInstance()->UpdateActionCount(btMsg);
+                        int count = Workspace::GetInstance()->UpdateActionCount(pAgent, btMsg);
 
                         behaviac::string buffer = FormatString("[tick]%s %s [%s] [%d]\n", agentName.c_str(), btMsg, actionResultStr, count);
 
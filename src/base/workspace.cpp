@@ -28,6 +28,12 @@
 
 #include "behaviac/base/core/profiler/profiler.h"
 #include "behaviac/htn/agentproperties.h"
+#include "behaviac/base/core/thread/thread.h"
+#include "behaviac/base/core/thread/wrapper.h"
+#include "behaviac/base/core/crc.h"
+#include "behaviac/base/core/lz.h"
+
+#include <algorithm>
 
 namespace behaviac
 {
@@ -177,7 +183,8 @@ namespace behaviac
 
     Workspace* Workspace::ms_instance = 0;
 
-    Workspace::Workspace() : m_bInited(false), m_bExecAgents(true), m_fileFormat(Workspace::EFF_xml), m_frame(0),
+    Workspace::Workspace() : m_bInited(false), m_bExecAgents(true), m_fileFormat(Workspace::EFF_xml), m_bFileMapping(false), m_bSubtreeSharing(false), m_frame(0),
+        m_preloadItems(0), m_archive(0), m_archiveSize(0), m_residentBytes(0), m_memoryBudget(0), m_residentClock(0),
         m_pBehaviorNodeLoader(0), m_behaviortreeCreators(0),
         m_fileBuffer(0), m_fileBufferTop(0), m_timeSinceStartup(0),
         m_deltaTime(0), m_deltaFrames(0)
@@ -264,6 +271,26 @@ namespace behaviac
         this->m_fileFormat = ff;
     }
 
+    bool Workspace::IsFileMapping() const
+    {
+        return this->m_bFileMapping;
+    }
+
+    void Workspace::SetFileMapping(bool bFileMapping)
+    {
+        this->m_bFileMapping = bFileMapping;
+    }
+
+    bool Workspace::IsSubtreeSharing() const
+    {
+        return this->m_bSubtreeSharing;
+    }
+
+    void Workspace::SetSubtreeSharing(bool bSubtreeSharing)
+    {
+        this->m_bSubtreeSharing = bSubtreeSharing;
+    }
+
     void Workspace::BehaviorNodeLoaded(const char* nodeType, const properties_t& properties)
     {
         if (this->m_pBehaviorNodeLoader)
@@ -525,6 +552,8 @@ namespace behaviac
 
     void Workspace::Cleanup()
     {
+        this->CancelAsyncLoads();
+
 #if BEHAVIAC_ENABLE_HOTRELOAD
 
         if (m_allBehaviorTreeTasks)
@@ -543,9 +572,12 @@ namespace behaviac
         Agent::Cleanup();
 
         this->UnLoadAll();
+        m_behaviorTreeTaskPools.clear();
+
         this->UnRegisterBasicNodes();
 
         Workspace::FreeFileBuffer();
+        this->UnLoadArchive();
         BaseStop();
 
         this->m_bInited = false;
@@ -607,6 +639,178 @@ namespace behaviac
         return ReadFileToBuffer(path);
     }
 
+    //the compressed container: the header and then the blocks, each of which is prefixed by its compressed size.
+    //a block which isn't shrunk is stored as it is, its size is then the block size, or the rest of the content for the last one.
+    static const uint32_t kCompressedMagic = 0x5a4c5442;//'BTLZ'
+    static const uint32_t kCompressedVersion = 1;
+    static const uint32_t kCompressedBlockSize = 64 * 1024;
+
+    //the limits of the untrusted headers, way beyond what CompressContent writes for any behavior tree
+    static const uint32_t kCompressedMaxBlockSize = 16 * kCompressedBlockSize;
+    static const uint32_t kCompressedMaxContentSize = 256 * 1024 * 1024;
+
+    struct CompressedHeader_t
+    {
+        uint32_t	magic;
+        uint32_t	version;
+        uint32_t	contentSize;
+        uint32_t	blockSize;
+    };
+
+    //the blocks are read from either a file or the memory of a mapped file or an archive
+    struct CompressedReader_t
+    {
+        IFile*		fp;
+        const char*	pData;
+        uint32_t	size;
+
+        uint32_t Read(void* pBuffer, uint32_t numberOfBytesToRead)
+        {
+            if (this->fp)
+            {
+                return this->fp->Read(pBuffer, numberOfBytesToRead);
+            }
+
+            if (numberOfBytesToRead > this->size)
+            {
+                numberOfBytesToRead = this->size;
+            }
+
+            memcpy(pBuffer, this->pData, numberOfBytesToRead);
+            this->pData += numberOfBytesToRead;
+            this->size -= numberOfBytesToRead;
+
+            return numberOfBytesToRead;
+        }
+    };
+
+    static bool IsCompressed(const char* pData, uint32_t size)
+    {
+        return size >= sizeof(CompressedHeader_t) && ((const CompressedHeader_t*)pData)->magic == kCompressedMagic;
+    }
+
+    //the header is checked before header.contentSize + 1 bytes are allocated for the content.
+    //each block takes at least its size prefix and one byte in the 'compressedSize' bytes of the compressed data.
+    static bool IsValidCompressedHeader(const CompressedHeader_t& header, uint32_t compressedSize)
+    {
+        if (header.version != kCompressedVersion || header.blockSize == 0 || header.blockSize > kCompressedMaxBlockSize ||
+            header.contentSize > kCompressedMaxContentSize || compressedSize < sizeof(CompressedHeader_t))
+        {
+            return false;
+        }
+
+        uint32_t blockCount = header.contentSize / header.blockSize + (header.contentSize % header.blockSize != 0 ? 1 : 0);
+
+        return blockCount <= (compressedSize - sizeof(CompressedHeader_t)) / (sizeof(uint32_t) + 1);
+    }
+
+    //the blocks are decompressed one by one into 'pContent' as they are read, 'pContent' has header.contentSize bytes
+    static bool DecompressBlocks(CompressedReader_t& reader, const CompressedHeader_t& header, char* pContent)
+    {
+        BEHAVIAC_ASSERT(header.blockSize != 0);
+
+        const uint32_t blockBound = LZ::CompressBound(header.blockSize);
+        char* pBlock = (char*)BEHAVIAC_MALLOC(blockBound);
+        bool bOk = true;
+
+        for (uint32_t offset = 0; bOk && offset < header.contentSize; offset += header.blockSize)
+        {
+            uint32_t blockSize = header.contentSize - offset;
+
+            if (blockSize > header.blockSize)
+            {
+                blockSize = header.blockSize;
+            }
+
+            uint32_t compressedSize = 0;
+            bOk = reader.Read(&compressedSize, sizeof(compressedSize)) == sizeof(compressedSize) && compressedSize <= blockBound;
+
+            if (!bOk)
+            {
+                break;
+            }
+
+            if (compressedSize == blockSize)
+            {
+                bOk = reader.Read(pContent + offset, blockSize) == blockSize;
+            }
+            else
+            {
+                bOk = reader.Read(pBlock, compressedSize) == compressedSize &&
+                      LZ::Decompress(pBlock, compressedSize, pContent + offset, blockSize);
+            }
+        }
+
+        BEHAVIAC_FREE(pBlock);
+
+        return bOk;
+    }
+
+    //return the 0 terminated content of the compressed data, which is to be freed by BEHAVIAC_FREE, or 0 if it is corrupted
+    static char* DecompressContent(const char* pData, uint32_t size)
+    {
+        CompressedHeader_t header;
+        memcpy(&header, pData, sizeof(CompressedHeader_t));
+
+        if (!IsValidCompressedHeader(header, size))
+        {
+            return 0;
+        }
+
+        CompressedReader_t reader = { 0, pData + sizeof(CompressedHeader_t), size - (uint32_t)sizeof(CompressedHeader_t) };
+        char* pContent = (char*)BEHAVIAC_MALLOC(header.contentSize + 1);
+
+        if (!DecompressBlocks(reader, header, pContent))
+        {
+            BEHAVIAC_FREE(pContent);
+            return 0;
+        }
+
+        pContent[header.contentSize] = 0;
+
+        return pContent;
+    }
+
+    static void CompressContent(const char* pData, uint32_t size, behaviac::vector<char>& compressed)
+    {
+        CompressedHeader_t header;
+        header.magic = kCompressedMagic;
+        header.version = kCompressedVersion;
+        header.contentSize = size;
+        header.blockSize = kCompressedBlockSize;
+
+        const uint32_t blockBound = LZ::CompressBound(kCompressedBlockSize);
+        uint32_t compressedSize = sizeof(CompressedHeader_t);
+
+        compressed.resize(compressedSize + (size / kCompressedBlockSize + 1) * (sizeof(uint32_t) + blockBound));
+        memcpy(&compressed[0], &header, sizeof(CompressedHeader_t));
+
+        for (uint32_t offset = 0; offset < size; offset += kCompressedBlockSize)
+        {
+            uint32_t blockSize = size - offset;
+
+            if (blockSize > kCompressedBlockSize)
+            {
+                blockSize = kCompressedBlockSize;
+            }
+
+            char* pBlock = &compressed[compressedSize + sizeof(uint32_t)];
+            uint32_t blockCompressedSize = LZ::Compress(pData + offset, blockSize, pBlock, blockBound);
+
+            //the block which isn't shrunk is stored as it is
+            if (blockCompressedSize == 0 || blockCompressedSize >= blockSize)
+            {
+                blockCompressedSize = blockSize;
+                memcpy(pBlock, pData + offset, blockSize);
+            }
+
+            memcpy(&compressed[compressedSize], &blockCompressedSize, sizeof(uint32_t));
+            compressedSize += sizeof(uint32_t) + blockCompressedSize;
+        }
+
+        compressed.resize(compressedSize);
+    }
+
     char* Workspace::ReadFileToBuffer(const char* file)
     {
         IFile* fp = CFileManager::GetInstance()->FileOpen(file, CFileSystem::EOpenAccess_Read);
@@ -619,9 +823,35 @@ namespace behaviac
         //fp->Seek(0, CFileSystem::ESeekMoveMode_End);
         uint32_t fileSize = (uint32_t)fp->GetSize();
 
+        //the compressed file is decompressed into the buffer while it is being read
+        CompressedHeader_t header;
+        uint32_t headerSize = 0;
+        uint32_t contentSize = fileSize;
+
+        if (fileSize >= sizeof(CompressedHeader_t))
+        {
+            headerSize = fp->Read(&header, sizeof(CompressedHeader_t));
+        }
+
+        bool bCompressed = IsCompressed((const char*)&header, headerSize);
+
+        if (bCompressed)
+        {
+            if (!IsValidCompressedHeader(header, fileSize))
+            {
+                BEHAVIAC_LOGERROR("'%s' is corrupted!\n", file);
+
+                CFileManager::GetInstance()->FileClose(fp);
+
+                return 0;
+            }
+
+            contentSize = header.contentSize;
+        }
+
         BEHAVIAC_ASSERT(m_fileBufferTop < kFileBufferDepth - 1);
         uint32_t offset = m_fileBufferOffset[m_fileBufferTop++];
-        uint32_t offsetNew = offset + fileSize + 1;
+        uint32_t offsetNew = offset + contentSize + 1;
         m_fileBufferOffset[m_fileBufferTop] = offsetNew;
 
         if (m_fileBuffer == 0 || offsetNew > m_fileBufferLength)
@@ -642,14 +872,64 @@ namespace behaviac
 
         char* pBuffer = m_fileBuffer + offset;
 
-        fp->Read(pBuffer, sizeof(char) * fileSize);
-        pBuffer[fileSize] = 0;
+        if (bCompressed)
+        {
+            CompressedReader_t reader = { fp, 0, 0 };
+
+            if (!DecompressBlocks(reader, header, pBuffer))
+            {
+                BEHAVIAC_LOGERROR("'%s' is corrupted!\n", file);
+
+                CFileManager::GetInstance()->FileClose(fp);
+                this->PopFileFromBuffer(pBuffer);
+
+                return 0;
+            }
+        }
+        else
+        {
+            memcpy(pBuffer, &header, headerSize);
+            fp->Read(pBuffer + headerSize, sizeof(char) * (fileSize - headerSize));
+        }
+
+        pBuffer[contentSize] = 0;
 
         CFileManager::GetInstance()->FileClose(fp);
 
         return pBuffer;
     }
 
+    bool Workspace::CompressFile(const char* path, const char* compressedPath)
+    {
+        IFile* fp = CFileManager::GetInstance()->FileOpen(path, CFileSystem::EOpenAccess_Read);
+
+        if (!fp)
+        {
+            return false;
+        }
+
+        uint32_t fileSize = (uint32_t)fp->GetSize();
+        behaviac::vector<char> content;
+        content.resize(fileSize + 1);
+        fp->Read(&content[0], fileSize);
+        CFileManager::GetInstance()->FileClose(fp);
+
+        behaviac::vector<char> compressed;
+        CompressContent(&content[0], fileSize, compressed);
+
+        fp = CFileManager::GetInstance()->FileOpen(compressedPath, CFileSystem::EOpenAccess_Write);
+
+        if (!fp)
+        {
+            return false;
+        }
+
+        uint32_t written = fp->Write(&compressed[0], (uint32_t)compressed.size());
+        CFileManager::GetInstance()->FileClose(fp);
+
+        return written == compressed.size();
+    }
+
     bool Workspace::PopFileFromBuffer(const char* file, const char* str, char* pBuffer)
     {
         BEHAVIAC_UNUSED_VAR(file);
@@ -679,12 +959,17 @@ namespace behaviac
             this->HotReload();
         }
 
+        Context::execEvents(-1);
+
         if (this->m_bExecAgents)
         {
             int contextId = -1;
 
             Context::execAgents(contextId);
         }
+
+        this->FinishAsyncLoads(false);
+        this->EnforceMemoryBudget();
     }
 
     void Workspace::LogCurrentStates()
@@ -725,8 +1010,60 @@ namespace behaviac
         return true;
     }
 
+    //the locals added while building a tree, by their agent types, see Workspace::DeferLocal
+    typedef behaviac::vector<std::pair<behaviac::string, Property*> > DeferredLocals_t;
+
+    struct PreloadItem_t
+    {
+        behaviac::string			relativePath;
+        behaviac::string			fullPath;
+        bool						bXml;
+        char*						pBuffer;
+        rapidxml::xml_document<>*	pDocument;
+
+        //the hot reloaded trees are built by the worker, see Workspace::HotReloadAsync
+        bool								bBuild;
+        BehaviorTree*						pBuilt;
+        uint32_t							builtBytes;
+        behaviac::vector<behaviac::string>	references;
+        DeferredLocals_t					locals;
+
+        PreloadItem_t() : bXml(false), pBuffer(0), pDocument(0), bBuild(false), pBuilt(0), builtBytes(0)
+        {}
+    };
+
+    //the item whose tree the calling worker is building
+#if BEHAVIAC_COMPILER_MSVC
+    static __declspec(thread) PreloadItem_t* t_buildingItem;
+#else
+    static __thread PreloadItem_t* t_buildingItem;
+#endif
+
+    Property* Workspace::DeferLocal(const char* agentType, const char* typeName, const char* variableName, const char* valueStr)
+    {
+        if (!t_buildingItem)
+        {
+            return 0;
+        }
+
+        Property* pLocal = Property::Create(typeName, "Self", agentType, variableName, valueStr);
+        pLocal->m_bIsLocal = true;
+
+        t_buildingItem->locals.push_back(std::make_pair(behaviac::string(agentType ? agentType : ""), pLocal));
+
+        return pLocal;
+    }
+
     bool Workspace::Load(const char* relativePath, bool bForce)
     {
+        //the worker building a tree leaves its referenced trees to be loaded when the tree is swapped in
+        if (t_buildingItem)
+        {
+            t_buildingItem->references.push_back(relativePath);
+
+            return true;
+        }
+
         this->TryInit();
 
         //BEHAVIAC_ASSERT(behaviac::StringUtils::FindExtension(relativePath) == 0, "no extention to specify");
@@ -735,10 +1072,23 @@ namespace behaviac
         BehaviorTree* pBT = 0;
         BehaviorTrees_t::iterator it = m_behaviortrees.find(relativePath);
 
+        //the tree loading this one references it
+        if (!m_loadingTrees.empty())
+        {
+            m_loadingTrees.back().references.push_back(relativePath);
+        }
+
         if (it != m_behaviortrees.end())
         {
             if (!bForce)
             {
+                ResidentTrees_t::iterator itResident = m_residentTrees.find(relativePath);
+
+                if (itResident != m_residentTrees.end())
+                {
+                    itResident->second.lastUsed = ++m_residentClock;
+                }
+
                 return true;
             }
 
@@ -749,6 +1099,10 @@ namespace behaviac
 
         Workspace::EFileFormat f = this->GetFileFormat();
 
+        //the archived trees are loaded from the archive without checking their files
+        uint32_t archivedSize = 0;
+        const char* pArchived = (f != EFF_cpp) ? this->FindArchived(relativePath, f, archivedSize) : 0;
+
         switch (f)
         {
             case EFF_default:
@@ -811,46 +1165,138 @@ namespace behaviac
 
         BEHAVIAC_ASSERT(pBT);
 
+        this->BeginResidentTree(relativePath);
+
         bool bCleared = false;
 
-        if (f == EFF_xml || f == EFF_bson)
+        PreloadItem_t* pPreloaded = 0;
+
+        if (m_preloadItems && (f == EFF_xml || f == EFF_bson))
         {
-            char* pBuffer = ReadFileToBuffer(fullPath.c_str());
+            PreloadItems_t::iterator itPreloaded = m_preloadItems->find(relativePath);
 
-            if (pBuffer)
+            if (itPreloaded != m_preloadItems->end() && itPreloaded->second->pBuffer)
             {
-                //if forced to reload
-                if (!bNewly)
-                {
-                    bCleared = true;
-                    pBT->Clear();
-                }
+                pPreloaded = itPreloaded->second;
+            }
+        }
+
+        uint32_t mappedSize = 0;
+        const char* pMapped = 0;
+
+        if (!pPreloaded && !pArchived && f == EFF_bson && this->m_bFileMapping)
+        {
+            pMapped = CFileManager::GetInstance()->FileMap(fullPath.c_str(), mappedSize);
+        }
+
+        char* pBuffer = 0;
+
+        if (!pPreloaded && !pArchived && !pMapped && (f == EFF_xml || f == EFF_bson))
+        {
+            pBuffer = ReadFileToBuffer(fullPath.c_str());
+
+            //the corrupted file has been reported by ReadFileToBuffer
+            if (!pBuffer && !CFileManager::GetInstance()->FileExists(fullPath.c_str()))
+            {
+                BEHAVIAC_LOGERROR("'%s' doesn't exist!, Please check the file name or override Workspace and its GetFilePath()\n", fullPath.c_str());
+                BEHAVIAC_ASSERT(false);
+            }
+        }
 
-                if (f == EFF_xml)
+        //if forced to reload, the old content is only dropped when the new one is available
+        if (!bNewly && (pPreloaded || pArchived || pMapped || pBuffer || f == EFF_cpp))
+        {
+            bCleared = true;
+            this->ClearForReloading(pBT, relativePath);
+        }
+
+        if (pPreloaded)
+        {
+            if (pPreloaded->pDocument)
+            {
+                bLoadResult = pBT->load_xml(pPreloaded->pDocument->first_node("behavior"));
+            }
+            else
+            {
+                bLoadResult = pBT->load_bson(pPreloaded->pBuffer);
+            }
+        }
+        else if (pArchived)
+        {
+            if (f == EFF_xml)
+            {
+                //the xml is parsed in place, the archive is kept intact for the reloading
+                char* pBuffer = (char*)BEHAVIAC_MALLOC(archivedSize + 1);
+                memcpy(pBuffer, pArchived, archivedSize + 1);
+
+                bLoadResult = pBT->load_xml(pBuffer);
+
+                BEHAVIAC_FREE(pBuffer);
+            }
+            else if (IsCompressed(pArchived, archivedSize))
+            {
+                char* pContent = DecompressContent(pArchived, archivedSize);
+
+                if (pContent)
                 {
-                    bLoadResult = pBT->load_xml(pBuffer);
+                    bLoadResult = pBT->load_bson(pContent);
+                    BEHAVIAC_FREE(pContent);
                 }
-                else
+            }
+            else
+            {
+                bLoadResult = pBT->load_bson(pArchived);
+            }
+        }
+        else if (pMapped)
+        {
+            if (IsCompressed(pMapped, mappedSize))
+            {
+                char* pContent = DecompressContent(pMapped, mappedSize);
+
+                if (pContent)
                 {
-                    bLoadResult = pBT->load_bson(pBuffer);
+                    bLoadResult = pBT->load_bson(pContent);
+                    BEHAVIAC_FREE(pContent);
                 }
-
-                PopFileFromBuffer(pBuffer);
+            }
+            else if (this->m_bSubtreeSharing)
+            {
+                //the shared nodes outlive the tree they are loaded into, so they don't point into its mapping
+                bLoadResult = pBT->load_bson(pMapped);
             }
             else
             {
-                BEHAVIAC_LOGERROR("'%s' doesn't exist!, Please check the file name or override Workspace and its GetFilePath()\n", fullPath.c_str());
-                BEHAVIAC_ASSERT(false);
+                //the tree keeps the mapping, the strings of its nodes point into it instead of being copied,
+                //the bson documents carry their sizes, no terminating 0 is needed
+                pBT->KeepMapping(pMapped, mappedSize);
+                pMapped = 0;
+
+                LoadedString::SetKeptRange(pBT->m_pMapping, mappedSize);
+                bLoadResult = pBT->load_bson(pBT->m_pMapping);
+                LoadedString::SetKeptRange(0, 0);
+            }
+
+            if (pMapped)
+            {
+                CFileManager::GetInstance()->FileUnmap(pMapped, mappedSize);
             }
         }
-        else if (f == EFF_cpp)
+        else if (pBuffer)
         {
-            if (!bNewly)
+            if (f == EFF_xml)
             {
-                bCleared = true;
-                pBT->Clear();
+                bLoadResult = pBT->load_xml(pBuffer);
+            }
+            else
+            {
+                bLoadResult = pBT->load_bson(pBuffer);
             }
 
+            PopFileFromBuffer(pBuffer);
+        }
+        else if (f == EFF_cpp)
+        {
             if (m_behaviortreeCreators && m_behaviortreeCreators->find(relativePath) != m_behaviortreeCreators->end())
             {
                 BehaviorTreeCreator_t btCreator = (*m_behaviortreeCreators)[relativePath];
@@ -862,10 +1308,6 @@ namespace behaviac
                 BEHAVIAC_LOGWARNING("The behaviac_generated/behaviors/generated_behaviors.h should be included by one of your apps.");
             }
         }
-        else
-        {
-            BEHAVIAC_ASSERT(0);
-        }
 
         if (bLoadResult)
         {
@@ -875,6 +1317,17 @@ namespace behaviac
             {
                 BEHAVIAC_ASSERT(m_behaviortrees[pBT->GetName()] == pBT);
             }
+
+            if (this->m_bSubtreeSharing && f != EFF_cpp)
+            {
+                pBT->ShareSubtrees();
+            }
+            else
+            {
+                pBT->m_nodeIds.clear();
+            }
+
+            pBT->IndexTasks();
         }
         else
         {
@@ -894,6 +1347,8 @@ namespace behaviac
             BEHAVIAC_LOGWARNING("'%s' is not loaded!\n", fullPath.c_str());
         }
 
+        this->EndResidentTree(relativePath, bLoadResult);
+
         return bLoadResult;
     }
 
@@ -917,18 +1372,1047 @@ namespace behaviac
 
         return NULL;
     }
-    BehaviorTreeTask* Workspace::CreateBehaviorTreeTask(const char* relativePath)
+    struct PreloadContext_t
     {
-        BEHAVIAC_ASSERT(behaviac::StringUtils::FindExtension(relativePath) == 0, "no extention to specify");
-        BEHAVIAC_ASSERT(IsValidPath(relativePath));
+        behaviac::vector<PreloadItem_t>*	items;
+        behaviac::Mutex						cs;
+        uint32_t							next;
+        uint32_t							finished;
+    };
 
-        BehaviorTrees_t::iterator it = m_behaviortrees.find(relativePath);
-        const BehaviorTree* bt = 0;
+    void Workspace::BuildPreloadedTree(PreloadItem_t& item)
+    {
+        //the registered locals are only read while building, the new ones are deferred, see Workspace::DeferLocal
+        behaviac::ScopedLock lock(AgentProperties::ms_localsCs);
 
-        if (it != m_behaviortrees.end())
-        {
-            bt = it->second;
-        }
+        int64_t allocatedSize = GetThreadAllocatedSize();
+        BehaviorTree* pBT = BEHAVIAC_NEW BehaviorTree();
+
+        t_buildingItem = &item;
+
+        bool bLoaded = item.pDocument ? pBT->load_xml(item.pDocument->first_node("behavior")) : pBT->load_bson(item.pBuffer);
+
+        t_buildingItem = 0;
+
+        if (!bLoaded)
+        {
+            //the failure is reported by HotReload, which reads the file again
+            BEHAVIAC_DELETE(pBT);
+
+            return;
+        }
+
+        int64_t builtSize = GetThreadAllocatedSize();
+        item.pBuilt = pBT;
+        item.builtBytes = builtSize > allocatedSize ? (uint32_t)(builtSize - allocatedSize) : 0;
+    }
+
+    void PreloadItems(PreloadContext_t* ctx)
+    {
+        for (;;)
+        {
+            uint32_t index = 0;
+            {
+                behaviac::ScopedLock lock(ctx->cs);
+                index = ctx->next++;
+            }
+
+            if (index >= ctx->items->size())
+            {
+                break;
+            }
+
+            PreloadItem_t& item = (*ctx->items)[index];
+
+            if (item.fullPath.empty())
+            {
+                continue;
+            }
+
+            IFile* fp = CFileManager::GetInstance()->FileOpen(item.fullPath.c_str(), CFileSystem::EOpenAccess_Read);
+
+            if (!fp)
+            {
+                continue;
+            }
+
+            uint32_t fileSize = (uint32_t)fp->GetSize();
+            item.pBuffer = (char*)BEHAVIAC_MALLOC(fileSize + 1);
+            fp->Read(item.pBuffer, sizeof(char) * fileSize);
+            item.pBuffer[fileSize] = 0;
+
+            CFileManager::GetInstance()->FileClose(fp);
+
+            if (IsCompressed(item.pBuffer, fileSize))
+            {
+                char* pContent = DecompressContent(item.pBuffer, fileSize);
+                BEHAVIAC_FREE(item.pBuffer);
+
+                //the corrupted file is left to Load to report
+                item.pBuffer = pContent;
+
+                if (!pContent)
+                {
+                    continue;
+                }
+            }
+
+            if (item.bXml)
+            {
+                item.pDocument = BEHAVIAC_NEW rapidxml::xml_document<>();
+                item.pDocument->parse<0>(item.pBuffer);
+            }
+
+            if (item.bBuild)
+            {
+                Workspace::BuildPreloadedTree(item);
+            }
+        }
+    }
+
+    static unsigned int __STDCALL PreloadThreadFunction(void* arg)
+    {
+        PreloadContext_t* ctx = (PreloadContext_t*)arg;
+
+        PreloadItems(ctx);
+
+        behaviac::ScopedLock lock(ctx->cs);
+        ctx->finished++;
+
+        return 0;
+    }
+
+    static void FreePreloadItems(behaviac::vector<PreloadItem_t>& items)
+    {
+        for (uint32_t i = 0; i < items.size(); ++i)
+        {
+            PreloadItem_t& item = items[i];
+
+            //the ones not swapped in
+            if (item.pBuilt)
+            {
+                BEHAVIAC_DELETE(item.pBuilt);
+                item.pBuilt = 0;
+            }
+
+            for (uint32_t j = 0; j < item.locals.size(); ++j)
+            {
+                BEHAVIAC_DELETE(item.locals[j].second);
+            }
+
+            item.locals.clear();
+
+            if (item.pDocument)
+            {
+                BEHAVIAC_DELETE(item.pDocument);
+                item.pDocument = 0;
+            }
+
+            if (item.pBuffer)
+            {
+                BEHAVIAC_FREE(item.pBuffer);
+                item.pBuffer = 0;
+            }
+        }
+    }
+
+    void Workspace::MakePreloadItems(const behaviac::vector<behaviac::string>& relativePaths, behaviac::vector<PreloadItem_t>& items, bool bReload)
+    {
+        Workspace::EFileFormat f = this->GetFileFormat();
+
+        items.reserve(relativePaths.size());
+
+        behaviac::map<behaviac::string, bool> requested;
+
+        for (uint32_t i = 0; i < relativePaths.size(); ++i)
+        {
+            //the loaded trees are only read again to be reloaded
+            bool bLoaded = m_behaviortrees.find(relativePaths[i]) != m_behaviortrees.end();
+
+            if (bLoaded == bReload && !requested[relativePaths[i]])
+            {
+                requested[relativePaths[i]] = true;
+                items.push_back(PreloadItem_t());
+                PreloadItem_t& item = items.back();
+                item.relativePath = relativePaths[i];
+
+                //the loader callback is invoked on the main thread, so the trees are not built by the worker then
+                item.bBuild = bReload && !this->m_pBehaviorNodeLoader;
+
+                //the archived trees are not read from their files
+                if (this->IsArchived(relativePaths[i].c_str()))
+                {
+                    continue;
+                }
+
+                //like Load, the combined formats, EFF_default, take the xml file, then the bson one,
+                //the trees without either of them are left to Load to create from cpp
+                behaviac::string fullPath = StringUtils::CombineDir(this->GetFilePath(), relativePaths[i].c_str());
+                behaviac::string xmlPath = fullPath + ".xml";
+                behaviac::string bsonPath = fullPath + ".bson.bytes";
+
+                if (f == EFF_xml || (f == EFF_default && CFileManager::GetInstance()->FileExists(xmlPath.c_str())))
+                {
+                    item.bXml = true;
+                    item.fullPath = xmlPath;
+                }
+                else if (f == EFF_bson || (f == EFF_default && CFileManager::GetInstance()->FileExists(bsonPath.c_str())))
+                {
+                    item.fullPath = bsonPath;
+                }
+            }
+        }
+    }
+
+    uint32_t Workspace::LoadPreloadItems(behaviac::vector<PreloadItem_t>& items, bool bReload)
+    {
+        //the trees are created and published on this thread, Load uses the preloaded files,
+        //including the ones referenced by ReferencedBehavior nodes, the hot reloaded trees built by the worker are swapped in
+        PreloadItems_t preloadItems;
+
+        for (uint32_t i = 0; i < items.size(); ++i)
+        {
+            preloadItems[items[i].relativePath] = &items[i];
+        }
+
+        m_preloadItems = &preloadItems;
+
+        uint32_t count = 0;
+
+        for (uint32_t i = 0; i < items.size(); ++i)
+        {
+            PreloadItem_t& item = items[i];
+
+            if (bReload)
+            {
+                //the trees the worker failed to build are reloaded from their read files
+                if (item.pBuilt ? this->SwapBuiltTree(item) : this->HotReload(item.relativePath.c_str()))
+                {
+                    count++;
+                }
+            }
+            else if (m_behaviortrees.find(item.relativePath) != m_behaviortrees.end() || this->Load(item.relativePath.c_str()))
+            {
+                count++;
+            }
+        }
+
+        m_preloadItems = 0;
+
+        FreePreloadItems(items);
+
+        return count;
+    }
+
+    uint32_t Workspace::Preload(const behaviac::vector<behaviac::string>& relativePaths, uint32_t threadCount)
+    {
+        behaviac::vector<PreloadItem_t> items;
+        this->MakePreloadItems(relativePaths, items, false);
+
+        //the xml and the bson files are read and parsed concurrently, the cpp trees have no file to read
+        PreloadContext_t ctx;
+        ctx.items = &items;
+        ctx.next = 0;
+        ctx.finished = 0;
+
+        behaviac::vector<thread::ThreadHandle> threads;
+
+        for (uint32_t i = 1; i < threadCount && i < items.size(); ++i)
+        {
+            thread::ThreadHandle h = thread::CreateAndStartThread(&PreloadThreadFunction, &ctx, 0);
+
+            if (h)
+            {
+                threads.push_back(h);
+            }
+        }
+
+        PreloadItems(&ctx);
+
+        for (;;)
+        {
+            {
+                behaviac::ScopedLock lock(ctx.cs);
+
+                if (ctx.finished == threads.size())
+                {
+                    break;
+                }
+            }
+
+            behaviac::Thread::Sleep(1);
+        }
+
+        for (uint32_t i = 0; i < threads.size(); ++i)
+        {
+            thread::StopThread(threads[i]);
+        }
+
+        return this->LoadPreloadItems(items, false);
+    }
+
+    struct AsyncLoad_t
+    {
+        behaviac::vector<PreloadItem_t>	items;
+        PreloadContext_t				ctx;
+        thread::ThreadHandle			thread;
+        bool							bReload;
+    };
+
+    void Workspace::HotReloadAsync(const behaviac::vector<behaviac::string>& relativePaths)
+    {
+        Workspace::EFileFormat f = this->GetFileFormat();
+
+        if (f == EFF_cpp)
+        {
+            //there is no file to read ahead
+            for (uint32_t i = 0; i < relativePaths.size(); ++i)
+            {
+                this->HotReload(relativePaths[i].c_str());
+            }
+
+            return;
+        }
+
+        this->StartAsyncLoad(relativePaths, true);
+    }
+
+    void Workspace::LoadAsync(const behaviac::vector<behaviac::string>& relativePaths)
+    {
+        Workspace::EFileFormat f = this->GetFileFormat();
+
+        if (f == EFF_cpp)
+        {
+            //there is no file to read ahead
+            for (uint32_t i = 0; i < relativePaths.size(); ++i)
+            {
+                this->Load(relativePaths[i].c_str());
+            }
+
+            return;
+        }
+
+        this->StartAsyncLoad(relativePaths, false);
+    }
+
+    void Workspace::StartAsyncLoad(const behaviac::vector<behaviac::string>& relativePaths, bool bReload)
+    {
+        AsyncLoad_t* pLoad = BEHAVIAC_NEW AsyncLoad_t;
+        this->MakePreloadItems(relativePaths, pLoad->items, bReload);
+
+        if (pLoad->items.empty())
+        {
+            BEHAVIAC_DELETE(pLoad);
+            return;
+        }
+
+        pLoad->bReload = bReload;
+        pLoad->ctx.items = &pLoad->items;
+        pLoad->ctx.next = 0;
+        pLoad->ctx.finished = 0;
+        pLoad->thread = thread::CreateAndStartThread(&PreloadThreadFunction, &pLoad->ctx, 0);
+
+        if (!pLoad->thread)
+        {
+            //the files are read right away if no thread can be created
+            PreloadItems(&pLoad->ctx);
+            pLoad->ctx.finished = 1;
+        }
+
+        m_asyncLoads.push_back(pLoad);
+    }
+
+    uint32_t Workspace::FinishAsyncLoads(bool bWait)
+    {
+        uint32_t count = 0;
+
+        for (uint32_t i = 0; i < m_asyncLoads.size();)
+        {
+            AsyncLoad_t* pLoad = m_asyncLoads[i];
+            bool bFinished = false;
+
+            for (;;)
+            {
+                {
+                    behaviac::ScopedLock lock(pLoad->ctx.cs);
+                    bFinished = (pLoad->ctx.finished == 1);
+                }
+
+                if (bFinished || !bWait)
+                {
+                    break;
+                }
+
+                behaviac::Thread::Sleep(1);
+            }
+
+            if (!bFinished)
+            {
+                ++i;
+                continue;
+            }
+
+            if (pLoad->thread)
+            {
+                thread::StopThread(pLoad->thread);
+            }
+
+            m_asyncLoads.erase(m_asyncLoads.begin() + i);
+
+            count += this->LoadPreloadItems(pLoad->items, pLoad->bReload);
+            BEHAVIAC_DELETE(pLoad);
+        }
+
+        return count;
+    }
+
+    void Workspace::CancelAsyncLoads()
+    {
+        for (uint32_t i = 0; i < m_asyncLoads.size(); ++i)
+        {
+            AsyncLoad_t* pLoad = m_asyncLoads[i];
+
+            if (pLoad->thread)
+            {
+                for (;;)
+                {
+                    {
+                        behaviac::ScopedLock lock(pLoad->ctx.cs);
+
+                        if (pLoad->ctx.finished == 1)
+                        {
+                            break;
+                        }
+                    }
+
+                    behaviac::Thread::Sleep(1);
+                }
+
+                thread::StopThread(pLoad->thread);
+            }
+
+            FreePreloadItems(pLoad->items);
+            BEHAVIAC_DELETE(pLoad);
+        }
+
+        m_asyncLoads.clear();
+    }
+
+    static uint32_t EstimateNodeBytes(const BehaviorNode* node)
+    {
+        uint32_t bytes = sizeof(BehaviorNode);
+
+        for (uint32_t i = 0; i < node->GetChildrenCount(); ++i)
+        {
+            bytes += EstimateNodeBytes(node->GetChild(i));
+        }
+
+        for (uint32_t i = 0; i < node->GetAttachmentsCount(); ++i)
+        {
+            bytes += EstimateNodeBytes(node->GetAttachment(i));
+        }
+
+        return bytes;
+    }
+
+    void Workspace::BeginResidentTree(const char* relativePath)
+    {
+        m_loadingTrees.push_back(LoadingTree_t());
+
+        LoadingTree_t& loading = m_loadingTrees.back();
+        loading.relativePath = relativePath;
+        loading.allocatedSize = GetThreadAllocatedSize();
+        loading.nestedBytes = 0;
+        loading.builtBytes = 0;
+    }
+
+    void Workspace::EndResidentTree(const char* relativePath, bool bLoaded)
+    {
+        BEHAVIAC_ASSERT(!m_loadingTrees.empty() && m_loadingTrees.back().relativePath == relativePath);
+
+        LoadingTree_t loading = m_loadingTrees.back();
+        m_loadingTrees.pop_back();
+
+        //the bytes allocated by this thread while loading, the other threads don't add to them except the worker
+        //which built the tree, and the nested loads of the referenced trees are accounted to those trees
+        int64_t allocatedSize = GetThreadAllocatedSize();
+        uint32_t totalBytes = allocatedSize > loading.allocatedSize ? (uint32_t)(allocatedSize - loading.allocatedSize) : 0;
+        totalBytes += loading.builtBytes;
+
+        if (!m_loadingTrees.empty())
+        {
+            m_loadingTrees.back().nestedBytes += totalBytes;
+        }
+
+        BehaviorTrees_t::iterator itTree = m_behaviortrees.find(relativePath);
+
+        if (!bLoaded)
+        {
+            //a forced reload which fails before clearing the tree keeps the loaded one
+            if (itTree == m_behaviortrees.end())
+            {
+                this->RemoveResidentTree(relativePath);
+            }
+
+            return;
+        }
+
+        BEHAVIAC_ASSERT(itTree != m_behaviortrees.end());
+
+        uint32_t bytes = 0;
+
+        if (&GetMemoryAllocator() != &GetDefaultMemoryAllocator() || GetDefaultMemoryAllocator().GetAllocatedSize() == 0)
+        {
+            //the allocations of the loading thread are only tracked by the default allocator with its stats
+            bytes = EstimateNodeBytes(itTree->second);
+        }
+        else
+        {
+            bytes = totalBytes > loading.nestedBytes ? totalBytes - loading.nestedBytes : 0;
+        }
+
+        ResidentTree_t& tree = m_residentTrees[relativePath];
+
+        for (uint32_t i = 0; i < tree.references.size(); ++i)
+        {
+            ResidentTrees_t::iterator itReferenced = m_residentTrees.find(tree.references[i]);
+
+            if (itReferenced != m_residentTrees.end() && itReferenced->second.referencedBy > 0)
+            {
+                itReferenced->second.referencedBy--;
+            }
+        }
+
+        tree.references.clear();
+
+        for (uint32_t i = 0; i < loading.references.size(); ++i)
+        {
+            const behaviac::string& referenced = loading.references[i];
+
+            //self references and the repeated ones don't pin a tree
+            if (referenced == relativePath || m_behaviortrees.find(referenced) == m_behaviortrees.end() ||
+                std::find(tree.references.begin(), tree.references.end(), referenced) != tree.references.end())
+            {
+                continue;
+            }
+
+            m_residentTrees[referenced].referencedBy++;
+            tree.references.push_back(referenced);
+        }
+
+        m_residentBytes -= tree.bytes;
+        tree.bytes = bytes;
+        m_residentBytes += bytes;
+        tree.lastUsed = ++m_residentClock;
+    }
+
+    void Workspace::RemoveResidentTree(const char* relativePath)
+    {
+        ResidentTrees_t::iterator it = m_residentTrees.find(relativePath);
+
+        if (it == m_residentTrees.end())
+        {
+            return;
+        }
+
+        ResidentTree_t& tree = it->second;
+
+        for (uint32_t i = 0; i < tree.references.size(); ++i)
+        {
+            ResidentTrees_t::iterator itReferenced = m_residentTrees.find(tree.references[i]);
+
+            if (itReferenced != m_residentTrees.end() && itReferenced->second.referencedBy > 0)
+            {
+                itReferenced->second.referencedBy--;
+            }
+        }
+
+        m_residentBytes -= tree.bytes;
+
+        //the trees still referencing it keep its entry for its reloading
+        if (tree.referencedBy > 0)
+        {
+            tree.bytes = 0;
+            tree.references.clear();
+        }
+        else
+        {
+            m_residentTrees.erase(it);
+        }
+    }
+
+    void Workspace::SetMemoryBudget(uint32_t budgetBytes)
+    {
+        this->m_memoryBudget = budgetBytes;
+
+        this->EnforceMemoryBudget();
+    }
+
+    uint32_t Workspace::GetMemoryBudget() const
+    {
+        return this->m_memoryBudget;
+    }
+
+    uint32_t Workspace::GetResidentBytes() const
+    {
+        return this->m_residentBytes;
+    }
+
+    uint32_t Workspace::GetResidentBytes(const char* relativePath) const
+    {
+        ResidentTrees_t::const_iterator it = m_residentTrees.find(relativePath);
+
+        return it != m_residentTrees.end() ? it->second.bytes : 0;
+    }
+
+    uint32_t Workspace::EnforceMemoryBudget()
+    {
+        //the trees being loaded can't be evicted
+        if (!m_loadingTrees.empty())
+        {
+            return 0;
+        }
+
+        uint32_t count = 0;
+
+        while (m_memoryBudget > 0 && m_residentBytes > m_memoryBudget)
+        {
+            typedef std::pair<uint32_t, behaviac::string> Candidate_t;
+            behaviac::vector<Candidate_t> candidates;
+
+            for (ResidentTrees_t::iterator it = m_residentTrees.begin(); it != m_residentTrees.end(); ++it)
+            {
+                const ResidentTree_t& tree = it->second;
+
+                if (tree.referencedBy > 0)
+                {
+                    continue;
+                }
+
+                BehaviorTrees_t::iterator itTree = m_behaviortrees.find(it->first);
+
+                if (itTree != m_behaviortrees.end() && itTree->second && m_liveTasks.find(itTree->second) == m_liveTasks.end())
+                {
+                    candidates.push_back(Candidate_t(tree.lastUsed, it->first));
+                }
+            }
+
+            if (candidates.empty())
+            {
+                break;
+            }
+
+            //the least recently used first, evicting a tree might unpin the trees referenced by it for the next round
+            std::sort(candidates.begin(), candidates.end());
+
+            for (uint32_t i = 0; i < candidates.size() && m_residentBytes > m_memoryBudget; ++i)
+            {
+                this->UnLoad(candidates[i].second.c_str());
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    void Workspace::GetExportedFiles(const char* ext, behaviac::vector<behaviac::string>& relativePaths)
+    {
+        const uint32_t extLength = strlen(ext);
+
+        behaviac::string root = StringUtils::CombineDir(this->GetFilePath(), "");
+        behaviac::string filter = root + "*" + ext;
+#if BEHAVIAC_COMPILER_MSVC
+        std::replace(filter.begin(), filter.end(), '/', '\\');
+#endif
+        behaviac::vector<behaviac::string> files;
+        CFileSystem::findFiles(filter.c_str(), files, true, false, true, 0, true);
+
+        for (uint32_t i = 0; i < files.size(); ++i)
+        {
+            const behaviac::string& file = files[i];
+
+            if (file.size() <= root.size() + extLength)
+            {
+                continue;
+            }
+
+            behaviac::string relativePath = file.substr(root.size(), file.size() - root.size() - extLength);
+            std::replace(relativePath.begin(), relativePath.end(), '\\', '/');
+
+            //the exported blackboard and the debug info are not behavior trees
+            if (relativePath == "behaviac.bb" || relativePath == "behaviors.dbg")
+            {
+                continue;
+            }
+
+            relativePaths.push_back(relativePath);
+        }
+    }
+
+    uint32_t Workspace::PreloadAll(uint32_t threadCount)
+    {
+        behaviac::vector<behaviac::string> relativePaths;
+        Workspace::EFileFormat f = this->GetFileFormat();
+
+        //like Load, the combined formats, EFF_default, take the trees of each of them
+        if ((f & EFF_xml) != 0)
+        {
+            this->GetExportedFiles(".xml", relativePaths);
+        }
+
+        if ((f & EFF_bson) != 0)
+        {
+            this->GetExportedFiles(".bson.bytes", relativePaths);
+        }
+
+        if ((f & EFF_cpp) != 0 && m_behaviortreeCreators)
+        {
+            for (BehaviorTreeCreators_t::iterator it = m_behaviortreeCreators->begin(); it != m_behaviortreeCreators->end(); ++it)
+            {
+                relativePaths.push_back(it->first);
+            }
+        }
+
+        //a tree exported in several formats is only loaded once, in the format Load picks
+        std::sort(relativePaths.begin(), relativePaths.end());
+        relativePaths.erase(std::unique(relativePaths.begin(), relativePaths.end()), relativePaths.end());
+
+        return this->Preload(relativePaths, threadCount);
+    }
+
+    //the archive is laid out as the header, the index, the string table of the paths and the payloads.
+    //the index is an open addressing hash table of the paths with a power of 2 buckets.
+    //the payloads are 0 terminated and all the offsets are from the beginning of the archive.
+    static const uint32_t kArchiveMagic = 0x4b505442;//'BTPK'
+    static const uint32_t kArchiveVersion = 1;
+    static const uint32_t kArchiveEmptyBucket = 0xffffffff;
+
+    struct ArchiveHeader_t
+    {
+        uint32_t	magic;
+        uint32_t	version;
+        uint32_t	treeCount;
+        uint32_t	bucketCount;
+        uint32_t	stringsOffset;
+        uint32_t	stringsSize;
+    };
+
+    struct ArchiveEntry_t
+    {
+        uint32_t	hash;
+        uint32_t	pathOffset;
+        uint32_t	format;
+        uint32_t	payloadOffset;
+        uint32_t	payloadSize;
+    };
+
+    bool Workspace::ExportArchive(const char* archivePath, bool bCompressBson)
+    {
+        Workspace::EFileFormat f = this->GetFileFormat();
+
+        behaviac::vector<behaviac::string> relativePaths;
+        behaviac::vector<Workspace::EFileFormat> formats;
+
+        if (f & EFF_xml)
+        {
+            this->GetExportedFiles(".xml", relativePaths);
+            formats.resize(relativePaths.size(), EFF_xml);
+        }
+
+        if (f & EFF_bson)
+        {
+            behaviac::map<behaviac::string, bool> xmlPaths;
+
+            for (uint32_t i = 0; i < relativePaths.size(); ++i)
+            {
+                xmlPaths[relativePaths[i]] = true;
+            }
+
+            behaviac::vector<behaviac::string> bsonPaths;
+            this->GetExportedFiles(".bson.bytes", bsonPaths);
+
+            for (uint32_t i = 0; i < bsonPaths.size(); ++i)
+            {
+                if (xmlPaths.find(bsonPaths[i]) == xmlPaths.end())
+                {
+                    relativePaths.push_back(bsonPaths[i]);
+                    formats.push_back(EFF_bson);
+                }
+            }
+        }
+
+        if (relativePaths.empty())
+        {
+            return false;
+        }
+
+        uint32_t bucketCount = 1;
+
+        while (bucketCount < relativePaths.size() * 2)
+        {
+            bucketCount <<= 1;
+        }
+
+        ArchiveHeader_t header;
+        header.magic = kArchiveMagic;
+        header.version = kArchiveVersion;
+        header.treeCount = (uint32_t)relativePaths.size();
+        header.bucketCount = bucketCount;
+        header.stringsOffset = sizeof(ArchiveHeader_t) + bucketCount * sizeof(ArchiveEntry_t);
+        header.stringsSize = 0;
+
+        for (uint32_t i = 0; i < relativePaths.size(); ++i)
+        {
+            header.stringsSize += (uint32_t)relativePaths[i].size() + 1;
+        }
+
+        behaviac::vector<char> archive;
+        archive.resize(header.stringsOffset + header.stringsSize, 0);
+        ArchiveEntry_t* entries = (ArchiveEntry_t*)&archive[sizeof(ArchiveHeader_t)];
+
+        for (uint32_t i = 0; i < bucketCount; ++i)
+        {
+            entries[i].pathOffset = kArchiveEmptyBucket;
+        }
+
+        uint32_t pathOffset = header.stringsOffset;
+
+        for (uint32_t i = 0; i < relativePaths.size(); ++i)
+        {
+            const behaviac::string& relativePath = relativePaths[i];
+            behaviac::string fullPath = StringUtils::CombineDir(this->GetFilePath(), relativePath.c_str()) + (formats[i] == EFF_xml ? ".xml" : ".bson.bytes");
+
+            IFile* fp = CFileManager::GetInstance()->FileOpen(fullPath.c_str(), CFileSystem::EOpenAccess_Read);
+
+            if (!fp)
+            {
+                return false;
+            }
+
+            //the payloads are 8 bytes aligned
+            uint32_t payloadSize = (uint32_t)fp->GetSize();
+            uint32_t payloadOffset = (uint32_t)((archive.size() + 7) & ~7);
+            archive.resize(payloadOffset + payloadSize + 1, 0);
+
+            //'entries' might be moved by the resize above
+            entries = (ArchiveEntry_t*)&archive[sizeof(ArchiveHeader_t)];
+
+            fp->Read(&archive[payloadOffset], payloadSize);
+            CFileManager::GetInstance()->FileClose(fp);
+
+            if (bCompressBson && formats[i] == EFF_bson && !IsCompressed(&archive[payloadOffset], payloadSize))
+            {
+                behaviac::vector<char> compressed;
+                CompressContent(&archive[payloadOffset], payloadSize, compressed);
+
+                payloadSize = (uint32_t)compressed.size();
+                archive.resize(payloadOffset + payloadSize + 1, 0);
+                memcpy(&archive[payloadOffset], &compressed[0], payloadSize);
+                archive[payloadOffset + payloadSize] = 0;
+
+                entries = (ArchiveEntry_t*)&archive[sizeof(ArchiveHeader_t)];
+            }
+
+            uint32_t hash = CRC32::CalcCRC(relativePath.c_str());
+            uint32_t bucket = hash & (bucketCount - 1);
+
+            while (entries[bucket].pathOffset != kArchiveEmptyBucket)
+            {
+                bucket = (bucket + 1) & (bucketCount - 1);
+            }
+
+            ArchiveEntry_t& entry = entries[bucket];
+            entry.hash = hash;
+            entry.pathOffset = pathOffset;
+            entry.format = formats[i];
+            entry.payloadOffset = payloadOffset;
+            entry.payloadSize = payloadSize;
+
+            memcpy(&archive[pathOffset], relativePath.c_str(), relativePath.size() + 1);
+            pathOffset += (uint32_t)relativePath.size() + 1;
+        }
+
+        memcpy(&archive[0], &header, sizeof(ArchiveHeader_t));
+
+        IFile* fp = CFileManager::GetInstance()->FileOpen(archivePath, CFileSystem::EOpenAccess_Write);
+
+        if (!fp)
+        {
+            return false;
+        }
+
+        uint32_t written = fp->Write(&archive[0], (uint32_t)archive.size());
+        CFileManager::GetInstance()->FileClose(fp);
+
+        return written == archive.size();
+    }
+
+    //all the offsets and the sizes are checked once here so that FindArchived can trust them
+    static bool IsValidArchive(const char* pArchive, uint32_t archiveSize)
+    {
+        if (archiveSize < sizeof(ArchiveHeader_t))
+        {
+            return false;
+        }
+
+        const ArchiveHeader_t* header = (const ArchiveHeader_t*)pArchive;
+
+        if (header->magic != kArchiveMagic || header->version != kArchiveVersion)
+        {
+            return false;
+        }
+
+        //the lookup masks the hashes with bucketCount - 1
+        if (header->bucketCount == 0 || (header->bucketCount & (header->bucketCount - 1)) != 0)
+        {
+            return false;
+        }
+
+        //the index has to fit before the string table, which has to fit in the archive
+        if (header->bucketCount > (archiveSize - sizeof(ArchiveHeader_t)) / sizeof(ArchiveEntry_t) ||
+            sizeof(ArchiveHeader_t) + header->bucketCount * sizeof(ArchiveEntry_t) > header->stringsOffset ||
+            header->stringsOffset > archiveSize || header->stringsSize > archiveSize - header->stringsOffset)
+        {
+            return false;
+        }
+
+        const ArchiveEntry_t* entries = (const ArchiveEntry_t*)(pArchive + sizeof(ArchiveHeader_t));
+        const char* pStringsEnd = pArchive + header->stringsOffset + header->stringsSize;
+        uint32_t usedBuckets = 0;
+
+        for (uint32_t i = 0; i < header->bucketCount; ++i)
+        {
+            const ArchiveEntry_t& entry = entries[i];
+
+            if (entry.pathOffset == kArchiveEmptyBucket)
+            {
+                continue;
+            }
+
+            usedBuckets++;
+
+            //the path is 0 terminated in the string table
+            if (entry.pathOffset < header->stringsOffset || entry.pathOffset >= header->stringsOffset + header->stringsSize ||
+                memchr(pArchive + entry.pathOffset, 0, pStringsEnd - (pArchive + entry.pathOffset)) == 0)
+            {
+                return false;
+            }
+
+            if (entry.format != Workspace::EFF_xml && entry.format != Workspace::EFF_bson)
+            {
+                return false;
+            }
+
+            //the payload is followed by its terminating 0
+            if (entry.payloadOffset > archiveSize || entry.payloadSize >= archiveSize - entry.payloadOffset ||
+                pArchive[entry.payloadOffset + entry.payloadSize] != 0)
+            {
+                return false;
+            }
+        }
+
+        //at least one empty bucket ends the probing of the paths not archived
+        return usedBuckets == header->treeCount && usedBuckets < header->bucketCount;
+    }
+
+    bool Workspace::LoadArchive(const char* archivePath)
+    {
+        this->UnLoadArchive();
+
+        IFile* fp = CFileManager::GetInstance()->FileOpen(archivePath, CFileSystem::EOpenAccess_Read);
+
+        if (!fp)
+        {
+            return false;
+        }
+
+        uint32_t archiveSize = (uint32_t)fp->GetSize();
+        char* pArchive = (char*)BEHAVIAC_MALLOC(archiveSize);
+        uint32_t read = fp->Read(pArchive, archiveSize);
+        CFileManager::GetInstance()->FileClose(fp);
+
+        if (read != archiveSize || !IsValidArchive(pArchive, archiveSize))
+        {
+            BEHAVIAC_LOGERROR("'%s' is not a valid behavior tree archive\n", archivePath);
+            BEHAVIAC_FREE(pArchive);
+
+            return false;
+        }
+
+        m_archive = pArchive;
+        m_archiveSize = archiveSize;
+
+        return true;
+    }
+
+    void Workspace::UnLoadArchive()
+    {
+        if (m_archive)
+        {
+            BEHAVIAC_FREE(m_archive);
+            m_archive = 0;
+            m_archiveSize = 0;
+        }
+    }
+
+    bool Workspace::IsArchived(const char* relativePath) const
+    {
+        Workspace::EFileFormat format = EFF_default;
+        uint32_t size = 0;
+
+        return this->FindArchived(relativePath, format, size) != 0;
+    }
+
+    const char* Workspace::FindArchived(const char* relativePath, Workspace::EFileFormat& format, uint32_t& size) const
+    {
+        if (!m_archive)
+        {
+            return 0;
+        }
+
+        const ArchiveHeader_t* header = (const ArchiveHeader_t*)m_archive;
+        const ArchiveEntry_t* entries = (const ArchiveEntry_t*)(m_archive + sizeof(ArchiveHeader_t));
+
+        uint32_t hash = CRC32::CalcCRC(relativePath);
+        uint32_t bucket = hash & (header->bucketCount - 1);
+
+        while (entries[bucket].pathOffset != kArchiveEmptyBucket)
+        {
+            const ArchiveEntry_t& entry = entries[bucket];
+
+            if (entry.hash == hash && strcmp(m_archive + entry.pathOffset, relativePath) == 0)
+            {
+                if ((format & entry.format) == 0)
+                {
+                    BEHAVIAC_LOGWARNING("'%s' is archived in another file format, it is loaded from its own file\n", relativePath);
+
+                    return 0;
+                }
+
+                format = (Workspace::EFileFormat)entry.format;
+                size = entry.payloadSize;
+
+                return m_archive + entry.payloadOffset;
+            }
+
+            bucket = (bucket + 1) & (header->bucketCount - 1);
+        }
+
+        return 0;
+    }
+
+    BehaviorTreeTask* Workspace::CreateBehaviorTreeTask(const char* relativePath)
+    {
+        BEHAVIAC_ASSERT(behaviac::StringUtils::FindExtension(relativePath) == 0, "no extention to specify");
+        BEHAVIAC_ASSERT(IsValidPath(relativePath));
+
+        BehaviorTrees_t::iterator it = m_behaviortrees.find(relativePath);
+        const BehaviorTree* bt = 0;
+
+        if (it != m_behaviortrees.end())
+        {
+            bt = it->second;
+        }
         else
         {
             bool bOk = (Workspace::Load(relativePath));
@@ -944,100 +2428,285 @@ namespace behaviac
             }
         }
 
-        if (bt)
-        {
-            BehaviorTask* task = bt->CreateAndInitTask();
-
-            BEHAVIAC_ASSERT(BehaviorTreeTask::DynamicCast(task));
-            BehaviorTreeTask* behaviorTreeTask = (BehaviorTreeTask*)task;
+        if (bt)
+        {
+            BehaviorTask* task = 0;
+
+            {
+                behaviac::ScopedLock lock(m_tasksCs);
+                BehaviorTreeTaskPools_t::iterator itPool = m_behaviorTreeTaskPools.find(relativePath);
+
+                if (itPool != m_behaviorTreeTaskPools.end())
+                {
+                    BehaviorTreeTaskPool_t& pool = itPool->second;
+                    pool.tree = bt;
+
+                    if (!pool.tasks.empty())
+                    {
+                        task = pool.tasks.back();
+                        pool.tasks.pop_back();
+                        pool.stats.hits++;
+                    }
+                    else
+                    {
+                        pool.stats.misses++;
+                    }
+
+                    pool.stats.pooled = (uint32_t)pool.tasks.size();
+                }
+            }
+
+            if (!task)
+            {
+                task = bt->CreateAndInitTask();
+            }
+
+            behaviac::ScopedLock lock(m_tasksCs);
+
+            m_liveTasks[bt]++;
+
+            ResidentTrees_t::iterator itResident = m_residentTrees.find(relativePath);
+
+            if (itResident != m_residentTrees.end())
+            {
+                itResident->second.lastUsed = ++m_residentClock;
+            }
+
+            BEHAVIAC_ASSERT(BehaviorTreeTask::DynamicCast(task));
+            BehaviorTreeTask* behaviorTreeTask = (BehaviorTreeTask*)task;
+
+#if BEHAVIAC_ENABLE_HOTRELOAD
+
+            if (!m_allBehaviorTreeTasks)
+            {
+                m_allBehaviorTreeTasks = BEHAVIAC_NEW AllBehaviorTreeTasks_t;
+            }
+
+            AllBehaviorTreeTasks_t::iterator it = m_allBehaviorTreeTasks->find(relativePath);
+
+            if (it == m_allBehaviorTreeTasks->end())
+            {
+                (*m_allBehaviorTreeTasks)[relativePath] = BTItem_t();
+            }
+
+            BTItem_t& btItems = (*m_allBehaviorTreeTasks)[relativePath];
+
+            bool isAdded = false;
+
+            for (uint32_t i = 0; i < btItems.bts.size(); ++i)
+            {
+                if (btItems.bts[i] == behaviorTreeTask)
+                {
+                    isAdded = true;
+                    break;
+                }
+            }
+
+            if (!isAdded)
+            {
+                btItems.bts.push_back(behaviorTreeTask);
+            }
+
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+
+            return behaviorTreeTask;
+        }
+
+        return 0;
+    }
+
+    void Workspace::DestroyBehaviorTreeTask(BehaviorTreeTask* behaviorTreeTask, Agent* agent)
+    {
+        BEHAVIAC_UNUSED_VAR(agent);
+
+        if (behaviorTreeTask)
+        {
+            BehaviorTreeTaskPool_t* pPool = 0;
+
+            {
+                behaviac::ScopedLock lock(m_tasksCs);
+
+#if BEHAVIAC_ENABLE_HOTRELOAD
+
+                if (m_allBehaviorTreeTasks)
+                {
+                    const char* relativePath = behaviorTreeTask->GetName().c_str();
+                    AllBehaviorTreeTasks_t::iterator it = m_allBehaviorTreeTasks->find(relativePath);
+
+                    if (it != m_allBehaviorTreeTasks->end())
+                    {
+                        BTItem_t& btItems = (*m_allBehaviorTreeTasks)[relativePath];
+
+                        for (behaviac::vector<BehaviorTreeTask*>::iterator it1 = btItems.bts.begin(); it1 != btItems.bts.end(); ++it1)
+                        {
+                            BehaviorTreeTask* bt = *it1;
+
+                            if (bt == behaviorTreeTask)
+                            {
+                                btItems.bts.erase(it1);
+                                break;
+                            }
+                        }
+
+                        if (agent)
+                        {
+                            for (behaviac::vector<Agent*>::iterator it1 = btItems.agents.begin(); it1 != btItems.agents.end(); ++it1)
+                            {
+                                Agent* a = (*it1);
+
+                                if (agent == a)
+                                {
+                                    btItems.agents.erase(it1);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
+
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+
+                //the task's tree might have been unloaded already, so it is only compared but not accessed
+                LiveTasks_t::iterator itLive = m_liveTasks.find(behaviorTreeTask->GetNode());
+
+                if (itLive != m_liveTasks.end() && --itLive->second == 0)
+                {
+                    m_liveTasks.erase(itLive);
+                }
+
+                for (BehaviorTreeTaskPools_t::iterator itPool = m_behaviorTreeTaskPools.begin(); itPool != m_behaviorTreeTaskPools.end(); ++itPool)
+                {
+                    BehaviorTreeTaskPool_t& pool = itPool->second;
+
+                    if (pool.tree && pool.tree == behaviorTreeTask->GetNode())
+                    {
+                        if (pool.tasks.size() < pool.stats.highWaterMark)
+                        {
+                            pPool = &pool;
+                        }
+                        else
+                        {
+                            pool.stats.discarded++;
+                        }
+
+                        break;
+                    }
+                }
+            }
+
+            if (pPool)
+            {
+                //resetting destroys the tasks of the referenced trees, which comes back here, so it is done without the lock,
+                //and the pool is checked again as it might have been filled in the meantime
+                behaviorTreeTask->reset(agent);
+
+                behaviac::ScopedLock lock(m_tasksCs);
+
+                if (pPool->tasks.size() < pPool->stats.highWaterMark)
+                {
+                    pPool->tasks.push_back(behaviorTreeTask);
+                    pPool->stats.pooled = (uint32_t)pPool->tasks.size();
+
+                    return;
+                }
+
+                pPool->stats.discarded++;
+            }
+
+            BehaviorTask::DestroyTask(behaviorTreeTask);
+        }
+    }
+
+    bool Workspace::SetBehaviorTreeTaskPool(const char* relativePath, uint32_t prewarmCount, uint32_t highWaterMark)
+    {
+        BEHAVIAC_ASSERT(behaviac::StringUtils::FindExtension(relativePath) == 0, "no extention to specify");
+        BEHAVIAC_ASSERT(IsValidPath(relativePath));
 
-#if BEHAVIAC_ENABLE_HOTRELOAD
+        if (highWaterMark == 0)
+        {
+            this->FreeBehaviorTreeTaskPool(relativePath);
+            m_behaviorTreeTaskPools.erase(relativePath);
 
-            if (!m_allBehaviorTreeTasks)
-            {
-                m_allBehaviorTreeTasks = BEHAVIAC_NEW AllBehaviorTreeTasks_t;
-            }
+            return true;
+        }
 
-            AllBehaviorTreeTasks_t::iterator it = m_allBehaviorTreeTasks->find(relativePath);
+        BehaviorTree* bt = this->LoadBehaviorTree(relativePath);
 
-            if (it == m_allBehaviorTreeTasks->end())
-            {
-                (*m_allBehaviorTreeTasks)[relativePath] = BTItem_t();
-            }
+        if (!bt)
+        {
+            return false;
+        }
 
-            BTItem_t& btItems = (*m_allBehaviorTreeTasks)[relativePath];
+        BehaviorTreeTaskPool_t& pool = m_behaviorTreeTaskPools[relativePath];
+        pool.tree = bt;
+        pool.stats.highWaterMark = highWaterMark;
 
-            bool isAdded = false;
+        if (prewarmCount > highWaterMark)
+        {
+            prewarmCount = highWaterMark;
+        }
 
-            for (uint32_t i = 0; i < btItems.bts.size(); ++i)
-            {
-                if (btItems.bts[i] == behaviorTreeTask)
-                {
-                    isAdded = true;
-                    break;
-                }
-            }
+        while (pool.tasks.size() > highWaterMark)
+        {
+            BehaviorTask::DestroyTask(pool.tasks.back());
+            pool.tasks.pop_back();
+            pool.stats.discarded++;
+        }
 
-            if (!isAdded)
-            {
-                btItems.bts.push_back(behaviorTreeTask);
-            }
+        pool.tasks.reserve(highWaterMark);
 
-#endif//BEHAVIAC_ENABLE_HOTRELOAD
+        while (pool.tasks.size() < prewarmCount)
+        {
+            BehaviorTask* task = bt->CreateAndInitTask();
+            BEHAVIAC_ASSERT(BehaviorTreeTask::DynamicCast(task));
 
-            return behaviorTreeTask;
+            pool.tasks.push_back((BehaviorTreeTask*)task);
         }
 
-        return 0;
+        pool.stats.pooled = (uint32_t)pool.tasks.size();
+
+        return true;
     }
 
-    void Workspace::DestroyBehaviorTreeTask(BehaviorTreeTask* behaviorTreeTask, Agent* agent)
+    bool Workspace::GetBehaviorTreeTaskPoolStats(const char* relativePath, BehaviorTreeTaskPoolStats_t& stats) const
     {
-        BEHAVIAC_UNUSED_VAR(agent);
+        BehaviorTreeTaskPools_t::const_iterator it = m_behaviorTreeTaskPools.find(relativePath);
 
-        if (behaviorTreeTask)
+        if (it != m_behaviorTreeTaskPools.end())
         {
-#if BEHAVIAC_ENABLE_HOTRELOAD
+            stats = it->second.stats;
 
-            if (m_allBehaviorTreeTasks)
-            {
-                const char* relativePath = behaviorTreeTask->GetName().c_str();
-                AllBehaviorTreeTasks_t::iterator it = m_allBehaviorTreeTasks->find(relativePath);
+            return true;
+        }
 
-                if (it != m_allBehaviorTreeTasks->end())
-                {
-                    BTItem_t& btItems = (*m_allBehaviorTreeTasks)[relativePath];
+        return false;
+    }
 
-                    for (behaviac::vector<BehaviorTreeTask*>::iterator it1 = btItems.bts.begin(); it1 != btItems.bts.end(); ++it1)
-                    {
-                        BehaviorTreeTask* bt = *it1;
+    void Workspace::ClearForReloading(BehaviorTree* pBT, const char* relativePath)
+    {
+        this->FreeBehaviorTreeTaskPool(relativePath);
+        pBT->Clear();
+    }
 
-                        if (bt == behaviorTreeTask)
-                        {
-                            btItems.bts.erase(it1);
-                            break;
-                        }
-                    }
+    void Workspace::FreeBehaviorTreeTaskPool(const char* relativePath)
+    {
+        for (BehaviorTreeTaskPools_t::iterator it = m_behaviorTreeTaskPools.begin(); it != m_behaviorTreeTaskPools.end(); ++it)
+        {
+            if (relativePath && it->first != relativePath)
+            {
+                continue;
+            }
 
-                    if (agent)
-                    {
-                        for (behaviac::vector<Agent*>::iterator it1 = btItems.agents.begin(); it1 != btItems.agents.end(); ++it1)
-                        {
-                            Agent* a = (*it1);
+            BehaviorTreeTaskPool_t& pool = it->second;
 
-                            if (agent == a)
-                            {
-                                btItems.agents.erase(it1);
-                                break;
-                            }
-                        }
-                    }
-                }
+            for (uint32_t i = 0; i < pool.tasks.size(); ++i)
+            {
+                BehaviorTask::DestroyTask(pool.tasks[i]);
             }
 
-#endif//BEHAVIAC_ENABLE_HOTRELOAD
-
-            BehaviorTask::DestroyTask(behaviorTreeTask);
+            pool.tasks.clear();
+            pool.tree = 0;
+            pool.stats.pooled = 0;
         }
     }
 
@@ -1046,6 +2715,7 @@ namespace behaviac
         BEHAVIAC_UNUSED_VAR(relativePath);
         BEHAVIAC_UNUSED_VAR(agent);
 #if BEHAVIAC_ENABLE_HOTRELOAD
+        behaviac::ScopedLock lock(m_tasksCs);
 
         if (!m_allBehaviorTreeTasks)
         {
@@ -1090,14 +2760,20 @@ namespace behaviac
 
         if (it != m_behaviortrees.end())
         {
+            this->FreeBehaviorTreeTaskPool(relativePath);
+
             BehaviorTree* bt = it->second;
             BEHAVIAC_DELETE(bt);
             m_behaviortrees.erase(it);
+
+            this->RemoveResidentTree(relativePath);
         }
     }
 
     void Workspace::UnLoadAll()
     {
+        this->FreeBehaviorTreeTaskPool(0);
+
         for (BehaviorTrees_t::iterator it = m_behaviortrees.begin();
              it != m_behaviortrees.end(); ++it)
         {
@@ -1107,6 +2783,9 @@ namespace behaviac
 
         m_behaviortrees.clear();
 
+        m_residentTrees.clear();
+        m_residentBytes = 0;
+
         m_workspace_file[0] = '\0';
     }
 
@@ -1143,6 +2822,7 @@ namespace behaviac
         if (fileCount > 0)
         {
             Workspace::EFileFormat f = Workspace::GetFileFormat();
+            behaviac::vector<behaviac::string> relativePaths;
 
             for (uint32_t i = 0; i < fileCount; ++i)
             {
@@ -1156,58 +2836,173 @@ namespace behaviac
                     behaviac::StringUtils::StripFullFileExtension(relativePath);
                     behaviac::StringUtils::UnifySeparator(relativePath);
 
-                    AllBehaviorTreeTasks_t::iterator it = m_allBehaviorTreeTasks->find(relativePath);
-
-                    if (it != m_allBehaviorTreeTasks->end())
+                    if (m_allBehaviorTreeTasks->find(relativePath) != m_allBehaviorTreeTasks->end())
                     {
-                        if (Workspace::Load(relativePath.c_str(), true))
-                        {
-                            //BEHAVIAC_LOGWARNING("HotReload 1:%s\n", relativePath.c_str());
+                        relativePaths.push_back(relativePath);
+                    }
+                }
+            }
 
-                            BTItem_t& btItems = (*m_allBehaviorTreeTasks)[relativePath];
-                            BehaviorTree* behaviorTree = m_behaviortrees[relativePath];
+            //the files are read and parsed on a worker thread, the trees are reloaded in the next Update
+            this->HotReloadAsync(relativePaths);
+        }
 
-                            uint32_t taskCount = btItems.bts.size();
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+    }
 
-                            if (taskCount > 0)
-                            {
-                                for (uint32_t i = 0; i < taskCount; ++i)
-                                {
-                                    BehaviorTreeTask* behaviorTreeTask = btItems.bts[i];
-                                    BEHAVIAC_ASSERT(behaviorTreeTask);
+    bool Workspace::HotReload(const char* relativePath)
+    {
+#if BEHAVIAC_ENABLE_HOTRELOAD
 
-                                    //BEHAVIAC_LOGWARNING("HotReload 2:%s\n", behaviorTreeTask->GetName().c_str());
+        if (!m_allBehaviorTreeTasks)
+        {
+            return false;
+        }
 
-                                    behaviorTreeTask->reset(0);
-                                    behaviorTreeTask->Clear();
-                                    behaviorTreeTask->Init(behaviorTree);
-                                }
-                            }
+        AllBehaviorTreeTasks_t::iterator it = m_allBehaviorTreeTasks->find(relativePath);
+        BehaviorTrees_t::iterator itTree = m_behaviortrees.find(relativePath);
 
-                            for (behaviac::vector<Agent*>::iterator it1 = btItems.agents.begin(); it1 != btItems.agents.end(); ++it1)
-                            {
-                                Agent* agent = (*it1);
+        if (it == m_allBehaviorTreeTasks->end() || itTree == m_behaviortrees.end())
+        {
+            return false;
+        }
 
-                                //BEHAVIAC_LOGWARNING("HotReload 3:%s\n", agent->GetName().c_str());
-                                agent->bthotreloaded(behaviorTree);
-                            }
-                        }
-                    }
-                }
-            }
+        BehaviorTree* behaviorTree = itTree->second;
+
+        //the tree is reloaded in place, the previous nodes are kept aside until the tasks are rebound
+        BehaviorTree* previous = BEHAVIAC_NEW BehaviorTree();
+        behaviorTree->SwapContent(previous);
+
+        if (!this->Load(relativePath, true))
+        {
+            //keep running the previous nodes
+            behaviorTree->Clear();
+            behaviorTree->SwapContent(previous);
+            m_behaviortrees[relativePath] = behaviorTree;
+
+            BEHAVIAC_DELETE(previous);
+
+            return false;
+        }
+
+        BEHAVIAC_ASSERT(m_behaviortrees[relativePath] == behaviorTree);
+
+        this->RebindBehaviorTreeTasks(it->second, behaviorTree, previous);
+
+        BEHAVIAC_DELETE(previous);
+
+        return true;
+#else
+        BEHAVIAC_UNUSED_VAR(relativePath);
+
+        return false;
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+    }
+
+    bool Workspace::SwapBuiltTree(PreloadItem_t& item)
+    {
+#if BEHAVIAC_ENABLE_HOTRELOAD
+        const char* relativePath = item.relativePath.c_str();
+
+        if (!m_allBehaviorTreeTasks)
+        {
+            return false;
+        }
+
+        AllBehaviorTreeTasks_t::iterator it = m_allBehaviorTreeTasks->find(relativePath);
+        BehaviorTrees_t::iterator itTree = m_behaviortrees.find(relativePath);
+
+        if (it == m_allBehaviorTreeTasks->end() || itTree == m_behaviortrees.end())
+        {
+            return false;
+        }
+
+        BehaviorTree* behaviorTree = itTree->second;
+        BEHAVIAC_ASSERT(item.pBuilt->GetName() == relativePath);
+
+        this->BeginResidentTree(relativePath);
+        m_loadingTrees.back().builtBytes = item.builtBytes;
+
+        //the worker leaves the referenced trees and the new locals to this thread
+        for (uint32_t i = 0; i < item.references.size(); ++i)
+        {
+            this->Load(item.references[i].c_str());
+        }
+
+        for (uint32_t i = 0; i < item.locals.size(); ++i)
+        {
+            AgentProperties::AddLocal(item.locals[i].first.c_str(), item.locals[i].second);
+        }
+
+        item.locals.clear();
+
+        //the built nodes are swapped into the loaded tree, which keeps its address held by the tasks and the callers
+        this->FreeBehaviorTreeTaskPool(relativePath);
+
+        BehaviorTree* previous = item.pBuilt;
+        item.pBuilt = 0;
+        behaviorTree->SwapContent(previous);
+
+        if (this->m_bSubtreeSharing)
+        {
+            behaviorTree->ShareSubtrees();
+        }
+        else
+        {
+            behaviorTree->m_nodeIds.clear();
         }
 
+        behaviorTree->IndexTasks();
+
+        this->EndResidentTree(relativePath, true);
+
+        this->RebindBehaviorTreeTasks(it->second, behaviorTree, previous);
+
+        BEHAVIAC_DELETE(previous);
+
+        return true;
+#else
+        BEHAVIAC_UNUSED_VAR(item);
+
+        return false;
 #endif//BEHAVIAC_ENABLE_HOTRELOAD
     }
 
+#if BEHAVIAC_ENABLE_HOTRELOAD
+    void Workspace::RebindBehaviorTreeTasks(BTItem_t& btItems, BehaviorTree* behaviorTree, BehaviorTree* previous)
+    {
+        for (uint32_t i = 0; i < btItems.bts.size(); ++i)
+        {
+            BehaviorTreeTask* behaviorTreeTask = btItems.bts[i];
+            BEHAVIAC_ASSERT(behaviorTreeTask);
+
+            if (!behaviorTreeTask->Rebind(previous))
+            {
+                behaviorTreeTask->reset(0);
+                behaviorTreeTask->Clear();
+                behaviorTreeTask->Init(behaviorTree);
+            }
+        }
+
+        //the agents' locals are kept if the tree's pars are not changed
+        if (!previous->IsSameContent(behaviorTree))
+        {
+            for (behaviac::vector<Agent*>::iterator it1 = btItems.agents.begin(); it1 != btItems.agents.end(); ++it1)
+            {
+                Agent* agent = (*it1);
+
+                agent->bthotreloaded(behaviorTree);
+            }
+        }
+    }
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////////
     /*uint32_t						Workspace::m_frame;
     behaviac::string				Workspace::m_applogFilter;
 
     Workspace::BreakpointInfos_t	Workspace::m_breakpoints;
 
-    Workspace::ActionCount_t		Workspace::m_actions_count;
-
     behaviac::Mutex					Workspace::m_cs;*/
 
     //[breakpoint] add TestBehaviorGroup\btunittest.xml->Sequence[3]:enter all Hit=1
@@ -1282,6 +3077,8 @@ namespace behaviac
 
         uint32_t bpid = MakeVariableId(bp.btname.c_str());
 
+        behaviac::ScopedLock lock(m_cs);
+
         if (bAdd)
         {
             m_breakpoints[bpid] = bp;
@@ -1425,6 +3222,7 @@ namespace behaviac
                     }
                     else if (tokens[0] == kStart)
                     {
+                        behaviac::ScopedLock lock(m_cs);
                         m_breakpoints.clear();
                         bContinue = true;
                     }
@@ -1438,6 +3236,7 @@ namespace behaviac
                     }
                     else if (tokens[0] == kCloseConnection)
                     {
+                        behaviac::ScopedLock lock(m_cs);
                         m_breakpoints.clear();
                         bContinue = true;
                     }
@@ -1478,24 +3277,67 @@ namespace behaviac
 #endif
             behaviac::string bpStr = BehaviorTask::GetTickInfo(pAgent, b, action);
 
-            uint32_t bpid = MakeVariableId(bpStr.c_str());
+            return this->CheckBreakpoint(pAgent, bpStr, actionResult);
+        }
+
+#endif//#if !defined(BEHAVIAC_RELEASE)
+        return false;
+    }
+
+    bool Workspace::CheckBreakpoint(const behaviac::Agent* pAgent, const behaviac::BehaviorTask* b, const char* action, EActionResult actionResult)
+    {
+        BEHAVIAC_UNUSED_VAR(pAgent);
+        BEHAVIAC_UNUSED_VAR(b);
+        BEHAVIAC_UNUSED_VAR(action);
+        BEHAVIAC_UNUSED_VAR(actionResult);
+#if !defined(BEHAVIAC_RELEASE)
+
+        if (Config::IsSocketing())
+        {
+#if BEHAVIAC_ENABLE_PROFILING
+            BEHAVIAC_PROFILE("Workspace::CheckBreakpoint");
+#endif
+            //the task's id is the one in its own tree even if its node is shared
+            behaviac::string bpStr = BehaviorTask::GetTickInfo(pAgent, b, action);
+
+            return this->CheckBreakpoint(pAgent, bpStr, actionResult);
+        }
+
+#endif//#if !defined(BEHAVIAC_RELEASE)
+        return false;
+    }
+
+    bool Workspace::CheckBreakpoint(const behaviac::Agent* pAgent, const behaviac::string& bpStr, EActionResult actionResult)
+    {
+        BEHAVIAC_UNUSED_VAR(pAgent);
+        BEHAVIAC_UNUSED_VAR(bpStr);
+        BEHAVIAC_UNUSED_VAR(actionResult);
+#if !defined(BEHAVIAC_RELEASE)
+        uint32_t bpid = MakeVariableId(bpStr.c_str());
+
+        BreakpointInfo_t bp;
+        {
+            behaviac::ScopedLock lock(m_cs);
 
             BreakpointInfos_t::const_iterator it = m_breakpoints.find(bpid);
 
-            if (it != m_breakpoints.end())
+            if (it == m_breakpoints.end())
             {
-                const BreakpointInfo_t& bp = it->second;
+                return false;
+            }
 
-                if (bp.action_result & actionResult)
-                {
-                    int count = GetActionCount(bpStr.c_str());
-                    BEHAVIAC_ASSERT(count > 0);
+            //copied out as the connection might change the breakpoints meanwhile
+            bp = it->second;
+        }
 
-                    if (bp.hit_config == 0 || bp.hit_config == count)
-                    {
-                        return true;
-                    }
-                }
+        if (bp.action_result & actionResult)
+        {
+            int count = GetActionCount(pAgent, bpStr.c_str());
+            BEHAVIAC_ASSERT(count > 0);
+
+            if (bp.hit_config == 0 || bp.hit_config == count)
+            {
+                return true;
             }
         }
 
@@ -1531,43 +3373,18 @@ namespace behaviac
         return false;
     }
 
-    int Workspace::UpdateActionCount(const char* actionString)
+    int Workspace::UpdateActionCount(const behaviac::Agent* pAgent, const char* actionString)
     {
-        behaviac::ScopedLock lock(m_cs);
-
-        int count = 1;
-        CStringID actionId(actionString);
-        ActionCount_t::iterator it = m_actions_count.find(actionId);
-
-        if (it == m_actions_count.end())
-        {
-            m_actions_count[actionId] = count;
-
-        }
-        else
-        {
-            count = m_actions_count[actionId];
-            count++;
-            m_actions_count[actionId] = count;
-        }
+        Context& c = Context::GetContext(pAgent->GetContextId());
 
-        return count;
+        return c.UpdateActionCount(actionString);
     }
 
-    int Workspace::GetActionCount(const char* actionString)
+    int Workspace::GetActionCount(const behaviac::Agent* pAgent, const char* actionString)
     {
-        behaviac::ScopedLock lock(m_cs);
-
-        int count = 0;
-        CStringID actionId(actionString);
-        ActionCount_t::iterator it = m_actions_count.find(actionId);
+        const Context& c = Context::GetContext(pAgent->GetContextId());
 
-        if (it != m_actions_count.end())
-        {
-            count = m_actions_count[actionId];
-        }
-
-        return count;
+        return c.GetActionCount(actionString);
     }
 }//namespace behaviac
 
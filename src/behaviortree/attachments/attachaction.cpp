@@ -199,7 +199,10 @@ namespace behaviac
         if (this->m_opl_m != NULL && this->m_operator == E_INVALID)
         {
             bValid = true;
-            this->m_opl_m->Invoke(pAgent);
+
+            //the return value is not used, it is not kept in the method
+            const Agent* pParent = this->m_opl_m->GetParentAgent(pAgent);
+            this->m_opl_m->run(pParent, pAgent, 0);
         }
         // assign
         else if (this->m_operator == E_ASSIGN)
@@ -224,6 +227,16 @@ namespace behaviac
         return bValid;
     }
 
+    const VariableComparator* AttachAction::ActionConfig::GetComparator() const
+    {
+        if (this->m_operator >= E_EQUAL && this->m_operator <= E_LESSEQUAL)
+        {
+            return this->m_comparator;
+        }
+
+        return 0;
+    }
+
     //implement the methods of AttachAction
     AttachAction::AttachAction()
     {
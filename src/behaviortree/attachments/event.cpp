@@ -53,7 +53,8 @@ namespace behaviac
         {
             const property_t& p = (*it);
 
-            if (strcmp(p.name, "EventName") == 0)
+            //the exported trees name it 'Task'
+            if (strcmp(p.name, "EventName") == 0 || strcmp(p.name, "Task") == 0)
             {
                 //method
                 this->m_event = Action::LoadMethod(p.value);
@@ -105,6 +106,16 @@ namespace behaviac
 
         return NULL;
     }
+    const CStringID& Event::GetEventId()
+    {
+        //m_event is also set directly by the generated cpp behaviors, so it is resolved on demand
+        if (!this->m_eventId.IsValid() && this->m_event != NULL)
+        {
+            this->m_eventId.SetContent(this->m_event->GetName());
+        }
+
+        return this->m_eventId;
+    }
     bool Event::TriggeredOnce()
     {
         return this->m_bTriggeredOnce;
@@ -21,6 +21,8 @@
 #include "behaviac/behaviortree/attachments/effector.h"
 #include "behaviac/fsm/state.h"
 #include "behaviac/htn/agentproperties.h"
+#include "behaviac/base/core/crc.h"
+#include "behaviac/base/file/filemanager.h"
 
 namespace rapidxml
 {
@@ -53,6 +55,105 @@ namespace behaviac
 {
     const char* BehaviorNode::LOCAL_TASK_PARAM_PRE = "_$local_task_param_$_";
 
+    //the kept file mapping the calling thread is loading a tree from, see LoadedString::SetKeptRange
+#if BEHAVIAC_COMPILER_MSVC
+    static __declspec(thread) const char* t_keptBegin;
+    static __declspec(thread) const char* t_keptEnd;
+#else
+    static __thread const char* t_keptBegin;
+    static __thread const char* t_keptEnd;
+#endif
+
+    LoadedString::LoadedString() : m_str(""), m_bOwned(false)
+    {
+    }
+
+    LoadedString::LoadedString(const LoadedString& copy) : m_str(""), m_bOwned(false)
+    {
+        *this = copy;
+    }
+
+    LoadedString::~LoadedString()
+    {
+        if (this->m_bOwned)
+        {
+            BEHAVIAC_FREE((void*)this->m_str);
+        }
+    }
+
+    LoadedString& LoadedString::operator=(const LoadedString& other)
+    {
+        if (this != &other)
+        {
+            if (other.m_bOwned)
+            {
+                this->Set(other.m_str);
+            }
+            else
+            {
+                //the kept mappings outlive the copies of their nodes' strings
+                this->Set("");
+                this->m_str = other.m_str;
+            }
+        }
+
+        return *this;
+    }
+
+    void LoadedString::Set(const char* str)
+    {
+        //'str' might be the owned string itself, it is released after being copied
+        const char* pOld = this->m_bOwned ? this->m_str : 0;
+
+        if (!str || str[0] == '\0')
+        {
+            this->m_str = "";
+            this->m_bOwned = false;
+        }
+        else if (str >= t_keptBegin && str < t_keptEnd)
+        {
+            this->m_str = str;
+            this->m_bOwned = false;
+        }
+        else
+        {
+            size_t len = strlen(str);
+            char* pCopy = (char*)BEHAVIAC_MALLOC(len + 1);
+            memcpy(pCopy, str, len + 1);
+
+            this->m_str = pCopy;
+            this->m_bOwned = true;
+        }
+
+        if (pOld)
+        {
+            BEHAVIAC_FREE((void*)pOld);
+        }
+    }
+
+    void LoadedString::swap(LoadedString& other)
+    {
+        const char* str = this->m_str;
+        bool bOwned = this->m_bOwned;
+
+        this->m_str = other.m_str;
+        this->m_bOwned = other.m_bOwned;
+
+        other.m_str = str;
+        other.m_bOwned = bOwned;
+    }
+
+    bool LoadedString::operator==(const LoadedString& other) const
+    {
+        return this->m_str == other.m_str || strcmp(this->m_str, other.m_str) == 0;
+    }
+
+    void LoadedString::SetKeptRange(const char* pBegin, uint32_t size)
+    {
+        t_keptBegin = pBegin;
+        t_keptEnd = pBegin ? pBegin + size : 0;
+    }
+
     static const char* kStrBehavior = "behavior";
     static const char* kStrAgentType = "agenttype";
 
@@ -92,6 +193,8 @@ namespace behaviac
     END_PROPERTIES_DESCRIPTION();
 
     CFactory<BehaviorNode>* BehaviorNode::ms_factory;
+    BehaviorNode::SharedNodes_t* BehaviorNode::ms_sharedNodes;
+
     CFactory<BehaviorNode>& BehaviorNode::Factory()
     {
         if (!ms_factory)
@@ -111,6 +214,17 @@ namespace behaviac
             BEHAVIAC_DELETE(ms_factory);
             ms_factory = 0;
         }
+
+        if (ms_sharedNodes)
+        {
+            for (SharedNodes_t::iterator it = ms_sharedNodes->begin(); it != ms_sharedNodes->end(); ++it)
+            {
+                it->second->m_bSharingRegistered = false;
+            }
+
+            BEHAVIAC_DELETE(ms_sharedNodes);
+            ms_sharedNodes = 0;
+        }
     }
 
     BehaviorNode* BehaviorNode::Create(const char* className)
@@ -121,15 +235,22 @@ namespace behaviac
     }
 
     BehaviorNode::BehaviorNode() : m_id(INVALID_NODE_ID),
-        m_enter_precond(0), m_update_precond(0), m_both_precond(0), m_both_effectors(0),
         m_attachments(0), m_pars(0), m_parent(0), m_children(0),
         m_customCondition(0), m_enterAction(0), m_exitAction(0),
-        m_bHasEvents(false), m_loadAttachment(false)
+        m_bHasEvents(false), m_loadAttachment(false), m_contentHash(0), m_sharedCount(0), m_bSharingRegistered(false)
     {
     }
 
     BehaviorNode::~BehaviorNode()
     {
+        BEHAVIAC_ASSERT(this->m_sharedCount == 0);
+
+        if (this->m_bSharingRegistered)
+        {
+            BEHAVIAC_ASSERT(ms_sharedNodes);
+            ms_sharedNodes->erase(this->GetSharingKey());
+        }
+
         this->Clear();
     }
 
@@ -171,7 +292,16 @@ namespace behaviac
             for (size_t i = 0; i < this->m_children->size(); ++i)
             {
                 BehaviorNode* pChild = (*m_children)[i];
-                BEHAVIAC_DELETE(pChild);
+
+                //a shared child is released by the last one holding it
+                if (pChild->m_sharedCount > 0)
+                {
+                    pChild->m_sharedCount--;
+                }
+                else
+                {
+                    BEHAVIAC_DELETE(pChild);
+                }
             }
 
             this->m_children->clear();
@@ -184,6 +314,9 @@ namespace behaviac
             BEHAVIAC_DELETE this->m_customCondition;
             this->m_customCondition = 0;
         }
+
+        this->m_contentHash = 0;
+        this->m_sharingContent.clear();
     }
 
     BehaviorTask* BehaviorNode::CreateAndInitTask() const
@@ -195,46 +328,25 @@ namespace behaviac
 
         return pTask;
     }
-    bool BehaviorNode::CheckPreconditions(const Agent* pAgent, bool bIsAlive) const
+    bool BehaviorNode::EvaluatePreconditions(const Agent* pAgent, const PhasePreconditions_t& preconds)
     {
-        Precondition::EPhase phase = bIsAlive ? Precondition::E_UPDATE : Precondition::E_ENTER;
+        BEHAVIAC_ASSERT(!preconds.empty());
 
-        //satisfied if there is no preconditions
-        if (this->m_preconditions.size() == 0)
-        {
-            return true;
-        }
+        //all of them are evaluated as they might have side effects
+        bool lastCombineValue = preconds[0].precond->Evaluate((Agent*)pAgent);
 
-        if (this->m_both_precond == 0)
+        for (uint32_t i = 1; i < preconds.size(); ++i)
         {
-            if (phase == Precondition::E_ENTER && this->m_enter_precond == 0)
-            {
-                return true;
-            }
+            const PhasePrecondition_t& p = preconds[i];
+            bool taskBoolean = p.precond->Evaluate((Agent*)pAgent);
 
-            if (phase == Precondition::E_UPDATE && this->m_update_precond == 0)
+            if (p.bAnd)
             {
-                return true;
+                lastCombineValue = lastCombineValue && taskBoolean;
             }
-        }
-
-        bool firstValidPrecond = true;
-        bool lastCombineValue = false;
-
-        for (uint32_t i = 0; i < this->m_preconditions.size(); ++i)
-        {
-            Precondition* pPrecond = (Precondition*)this->m_preconditions[i];
-
-            if (pPrecond != NULL)
+            else
             {
-                Precondition::EPhase ph = pPrecond->GetPhase();
-
-                if (ph == Precondition::E_BOTH || ph == phase)
-                {
-                    bool taskBoolean = pPrecond->Evaluate((Agent*)pAgent);
-
-                    CombineResults(firstValidPrecond, lastCombineValue, pPrecond, taskBoolean);
-                }
+                lastCombineValue = lastCombineValue || taskBoolean;
             }
         }
 
@@ -266,43 +378,53 @@ namespace behaviac
     }
     void BehaviorNode::ApplyEffects(Agent* pAgent, BehaviorNode::EPhase  phase) const
     {
-        if (this->m_effectors.size() == 0)
+        const behaviac::vector<BehaviorNode*>* effectors = &this->m_effectors;
+
+        if (phase == Effector::E_SUCCESS)
         {
-            return;
+            effectors = &this->m_successEffectors;
         }
-
-        if (this->m_both_effectors == 0)
+        else if (phase == Effector::E_FAILURE)
         {
-            if (phase == Effector::E_SUCCESS && this->m_success_effectors == 0)
-            {
-                return;
-            }
-
-            if (phase == Effector::E_FAILURE && this->m_failure_effectors == 0)
-            {
-                return;
-            }
+            effectors = &this->m_failureEffectors;
         }
 
-        for (uint32_t i = 0; i < this->m_effectors.size(); ++i)
+        for (uint32_t i = 0; i < effectors->size(); ++i)
         {
-            Effector* pEffector = (Effector*)this->m_effectors[i];
-
-            if (pEffector != NULL)
-            {
-                Effector::EPhase ph = pEffector->GetPhase();
-
-                if (phase == Effector::E_BOTH || ph == Effector::E_BOTH || ph == phase)
-                {
-                    pEffector->Evaluate((Agent*)pAgent);
-                }
-            }
+            (*effectors)[i]->Evaluate(pAgent);
         }
     }
     bool BehaviorNode::IsManagingChildrenAsSubTrees() const
     {
         return false;
     }
+
+    bool BehaviorNode::GetReadVariables(behaviac::vector<uint32_t>& variableIds) const
+    {
+        BEHAVIAC_UNUSED_VAR(variableIds);
+
+        return false;
+    }
+
+    bool BehaviorNode::IsPlain() const
+    {
+        return this->m_preconditions.empty() && this->m_effectors.empty() && this->m_events.empty() &&
+               this->m_customCondition == 0 && this->m_enterAction == 0 && this->m_exitAction == 0;
+    }
+
+    bool BehaviorNode::GetChildrenReadVariables(behaviac::vector<uint32_t>& variableIds) const
+    {
+        for (uint32_t i = 0; i < this->GetChildrenCount(); ++i)
+        {
+            if (!this->GetChild(i)->GetReadVariables(variableIds))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     void BehaviorNode::Attach(BehaviorNode* pAttachment, bool bIsPrecondition, bool bIsEffector, bool bIsTransition)
     {
         BEHAVIAC_UNUSED_VAR(bIsTransition);
@@ -317,27 +439,21 @@ namespace behaviac
             this->m_preconditions.push_back(predicate);
 
             Precondition::EPhase phase = predicate->GetPhase();
+            BEHAVIAC_ASSERT(phase == Precondition::E_ENTER || phase == Precondition::E_UPDATE || phase == Precondition::E_BOTH);
 
-            if (phase == Precondition::E_ENTER)
-            {
-                this->m_enter_precond++;
+            PhasePrecondition_t p;
+            p.precond = predicate;
+            p.bAnd = predicate->IsAnd();
 
-            }
-            else if (phase == Precondition::E_UPDATE)
+            if (phase == Precondition::E_ENTER || phase == Precondition::E_BOTH)
             {
-                this->m_update_precond++;
-
+                this->m_enterPreconds.push_back(p);
             }
-            else if (phase == Precondition::E_BOTH)
-            {
-                this->m_both_precond++;
 
-            }
-            else
+            if (phase == Precondition::E_UPDATE || phase == Precondition::E_BOTH)
             {
-                BEHAVIAC_ASSERT(false);
+                this->m_updatePreconds.push_back(p);
             }
-
         }
         else if (bIsEffector)
         {
@@ -348,27 +464,17 @@ namespace behaviac
             this->m_effectors.push_back(effector);
 
             Effector::EPhase phase = effector->GetPhase();
+            BEHAVIAC_ASSERT(phase == Effector::E_SUCCESS || phase == Effector::E_FAILURE || phase == Effector::E_BOTH);
 
-            if (phase == Effector::E_SUCCESS)
+            if (phase == Effector::E_SUCCESS || phase == Effector::E_BOTH)
             {
-                this->m_success_effectors++;
-
+                this->m_successEffectors.push_back(effector);
             }
-            else if (phase == Effector::E_FAILURE)
-            {
-                this->m_failure_effectors++;
 
-            }
-            else if (phase == Effector::E_BOTH)
+            if (phase == Effector::E_FAILURE || phase == Effector::E_BOTH)
             {
-                this->m_both_effectors++;
-
+                this->m_failureEffectors.push_back(effector);
             }
-            else
-            {
-                BEHAVIAC_ASSERT(false);
-            }
-
         }
         else
         {
@@ -478,12 +584,13 @@ namespace behaviac
 
     void BehaviorNode::SetClassNameString(const char* className)
     {
-        this->m_className = className;
+        this->m_className.Set(className);
+        this->CombineHash(className);
     }
 
-    const behaviac::string& BehaviorNode::GetClassNameString() const
+    const char* BehaviorNode::GetClassNameString() const
     {
-        return this->m_className;
+        return this->m_className.c_str();
     }
 
     int BehaviorNode::GetId() const
@@ -502,7 +609,7 @@ namespace behaviac
     {
         BEHAVIAC_UNUSED_VAR(agentType);
 #if !defined(BEHAVIAC_RELEASE)
-        this->m_agentType = agentType;
+        this->m_agentType.Set(agentType.c_str());
 #endif
     }
     int BehaviorNode::PreconditionsCount() const
@@ -521,6 +628,10 @@ namespace behaviac
         //clone it to avoid to be deleted twice
         pProperty = pProperty->clone();
 
+        this->CombineHash(type);
+        this->CombineHash(name);
+        this->CombineHash(value);
+
         if (!this->m_pars)
         {
             this->m_pars = BEHAVIAC_NEW Properties_t;
@@ -574,6 +685,272 @@ namespace behaviac
         this->m_customCondition = node;
     }
 
+    void BehaviorNode::CombineHash(uint32_t value)
+    {
+        this->m_contentHash ^= value + 0x9e3779b9 + (this->m_contentHash << 6) + (this->m_contentHash >> 2);
+    }
+
+    void BehaviorNode::CombineHash(const char* str)
+    {
+        this->CombineHash(CRC32::CalcCRC(str));
+
+        if (Workspace::GetInstance()->IsSubtreeSharing())
+        {
+            this->m_sharingContent.append(str);
+            this->m_sharingContent.push_back('\0');
+        }
+    }
+
+    void BehaviorNode::CombineHash(const properties_t& properties)
+    {
+        for (propertie_const_iterator_t it = properties.begin(); it != properties.end(); ++it)
+        {
+            this->CombineHash(it->name);
+            this->CombineHash(it->value);
+        }
+    }
+
+    void BehaviorNode::CombineHash(const BehaviorNode* pSubtree)
+    {
+        //the ids are not hashed so that the identical subtrees of different ids can be shared,
+        //IsSameContent compares the ids separately
+        this->CombineHash(pSubtree->m_contentHash);
+
+        if (pSubtree->m_children)
+        {
+            for (size_t i = 0; i < pSubtree->m_children->size(); ++i)
+            {
+                this->CombineHash((*pSubtree->m_children)[i]);
+            }
+        }
+    }
+
+    bool BehaviorNode::IsSameContent(const BehaviorNode* other) const
+    {
+        BEHAVIAC_ASSERT(other);
+
+        if (this->m_id != other->m_id || this->m_contentHash != other->m_contentHash)
+        {
+            return false;
+        }
+
+        uint32_t childrenCount = this->GetChildrenCount();
+
+        if (childrenCount != other->GetChildrenCount())
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < childrenCount; ++i)
+        {
+            if ((*this->m_children)[i]->m_id != (*other->m_children)[i]->m_id)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool BehaviorNode::IsSharable() const
+    {
+        return true;
+    }
+
+    bool BehaviorNode::IsSharableSubtree() const
+    {
+        if (!this->IsSharable() || (this->m_customCondition && !this->m_customCondition->IsSharableSubtree()))
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < this->GetAttachmentsCount(); ++i)
+        {
+            if (!(*this->m_attachments)[i]->IsSharableSubtree())
+            {
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < this->GetChildrenCount(); ++i)
+        {
+            if (!(*this->m_children)[i]->IsSharableSubtree())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static uint32_t CombineSharingKey(uint32_t key, uint32_t value)
+    {
+        return key ^ (value + 0x9e3779b9 + (key << 6) + (key >> 2));
+    }
+
+    uint32_t BehaviorNode::GetSharingKey() const
+    {
+        //the children are shared before their parents, so the same children are the same nodes
+        uint32_t key = CombineSharingKey(this->m_contentHash, CRC32::CalcCRC(this->m_agentType.c_str()));
+
+        for (uint32_t i = 0; i < this->GetChildrenCount(); ++i)
+        {
+            key = CombineSharingKey(key, (uint32_t)(size_t)(*this->m_children)[i]);
+        }
+
+        return key;
+    }
+
+    bool BehaviorNode::IsSharableWith(const BehaviorNode* other) const
+    {
+        //the hashes only rule out the different ones, they might collide
+        if (this->m_contentHash != other->m_contentHash)
+        {
+            return false;
+        }
+
+        return this->IsSameLoadedContent(other);
+    }
+
+    bool BehaviorNode::IsSameLoadedContent(const BehaviorNode* other) const
+    {
+        if (this == other)
+        {
+            return true;
+        }
+
+        if (this->m_bHasEvents != other->m_bHasEvents || this->m_className != other->m_className ||
+            this->m_agentType != other->m_agentType || this->m_sharingContent != other->m_sharingContent)
+        {
+            return false;
+        }
+
+        //the kind of an attachment, precondition, effector or event, is given by its class
+        uint32_t attachmentsCount = this->GetAttachmentsCount();
+
+        if (attachmentsCount != other->GetAttachmentsCount())
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < attachmentsCount; ++i)
+        {
+            if (!(*this->m_attachments)[i]->IsSameLoadedContent((*other->m_attachments)[i]))
+            {
+                return false;
+            }
+        }
+
+        if ((this->m_customCondition == 0) != (other->m_customCondition == 0) ||
+            (this->m_customCondition && !this->m_customCondition->IsSameLoadedContent(other->m_customCondition)))
+        {
+            return false;
+        }
+
+        //the children are shared before their parents, so the same children are mostly the same nodes
+        uint32_t childrenCount = this->GetChildrenCount();
+
+        if (childrenCount != other->GetChildrenCount())
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < childrenCount; ++i)
+        {
+            if (!(*this->m_children)[i]->IsSameLoadedContent((*other->m_children)[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void BehaviorNode::CollectIds(behaviac::vector<int>& ids) const
+    {
+        ids.push_back(this->m_id);
+
+        for (uint32_t i = 0; i < this->GetAttachmentsCount(); ++i)
+        {
+            (*this->m_attachments)[i]->CollectIds(ids);
+        }
+
+        for (uint32_t i = 0; i < this->GetChildrenCount(); ++i)
+        {
+            (*this->m_children)[i]->CollectIds(ids);
+        }
+    }
+
+    void BehaviorNode::CollectTaskIds(const behaviac::vector<int>& nodeIds, uint32_t& index, behaviac::vector<int>& ids) const
+    {
+        BEHAVIAC_ASSERT(nodeIds.empty() || index < nodeIds.size());
+        ids.push_back(index < nodeIds.size() ? nodeIds[index] : this->m_id);
+        index++;
+
+        //the attachments have their ids in 'nodeIds' but they are not collected by BehaviorTask::collecttasks
+        if (this->m_attachments)
+        {
+            behaviac::vector<int> attachmentIds;
+
+            for (uint32_t i = 0; i < this->m_attachments->size(); ++i)
+            {
+                (*this->m_attachments)[i]->CollectIds(attachmentIds);
+            }
+
+            index += (uint32_t)attachmentIds.size();
+        }
+
+        for (uint32_t i = 0; i < this->GetChildrenCount(); ++i)
+        {
+            (*this->m_children)[i]->CollectTaskIds(nodeIds, index, ids);
+        }
+    }
+
+    uint32_t BehaviorNode::ShareChildren()
+    {
+        uint32_t sharedCount = 0;
+
+        if (!this->m_children)
+        {
+            return 0;
+        }
+
+        if (!ms_sharedNodes)
+        {
+            ms_sharedNodes = BEHAVIAC_NEW SharedNodes_t;
+        }
+
+        for (size_t i = 0; i < this->m_children->size(); ++i)
+        {
+            BehaviorNode* pChild = (*this->m_children)[i];
+            sharedCount += pChild->ShareChildren();
+
+            uint32_t key = pChild->GetSharingKey();
+            SharedNodes_t::iterator it = ms_sharedNodes->find(key);
+
+            if (it == ms_sharedNodes->end())
+            {
+                (*ms_sharedNodes)[key] = pChild;
+                pChild->m_bSharingRegistered = true;
+            }
+            else if (it->second->IsSharableWith(pChild))
+            {
+                //all of pChild's children are shared by it->second as well, they are released by the deletion
+                BehaviorNode* pShared = it->second;
+                pShared->m_sharedCount++;
+                (*this->m_children)[i] = pShared;
+
+                //it has several parents now, the one it is loaded into might be released first
+                pShared->m_parent = 0;
+
+                BEHAVIAC_DELETE(pChild);
+                sharedCount++;
+            }
+        }
+
+        return sharedCount;
+    }
+
     //CMethodBase* LoadMethod(const char* value_);
 
     bool BehaviorNode::IsValid(Agent* pAgent, BehaviorTask* pTask) const
@@ -626,7 +1003,7 @@ namespace behaviac
     void BehaviorNode::load_properties(int version, const char* agentType, rapidxml::xml_node<>* node)
     {
 #if !defined(BEHAVIAC_RELEASE)
-        this->m_agentType = agentType;
+        this->m_agentType.Set(agentType);
 #endif//#ifdef _DEBUG
 
         properties_t properties;
@@ -649,6 +1026,7 @@ namespace behaviac
 
         if (properties.size() > 0)
         {
+            this->CombineHash(properties);
             this->load(version, agentType, properties);
         }
     }
@@ -734,7 +1112,8 @@ namespace behaviac
         return super::IsValid(pAgent, pTask);
     };
 
-    BehaviorTree::BehaviorTree() : BehaviorNode()
+    BehaviorTree::BehaviorTree() : BehaviorNode(), m_bPreconditionCaching(false), m_bTransitionCaching(false),
+        m_indexedTasksCount(0), m_pMapping(0), m_mappingSize(0)
     {
         this->m_bIsFSM = false;
     }
@@ -742,6 +1121,88 @@ namespace behaviac
     BehaviorTree::~BehaviorTree()
     {
         this->m_descriptorRefs.clear();
+
+        //the nodes are released first, they don't read their strings then
+        BehaviorNode::Clear();
+        this->KeepMapping(0, 0);
+    }
+
+    void BehaviorTree::Clear()
+    {
+        BehaviorNode::Clear();
+
+        //the agent type of the tree itself might point into the mapping
+        this->m_agentType.Set("");
+        this->KeepMapping(0, 0);
+    }
+
+    void BehaviorTree::KeepMapping(const char* pMapping, uint32_t mappingSize)
+    {
+        if (this->m_pMapping)
+        {
+            CFileManager::GetInstance()->FileUnmap(this->m_pMapping, this->m_mappingSize);
+        }
+
+        this->m_pMapping = pMapping;
+        this->m_mappingSize = mappingSize;
+    }
+
+    template<typename T>
+    static void SwapValue(T& a, T& b)
+    {
+        T t = a;
+        a = b;
+        b = t;
+    }
+
+    void BehaviorTree::SwapContent(BehaviorTree* other)
+    {
+        BEHAVIAC_ASSERT(other && other != this);
+
+        this->m_className.swap(other->m_className);
+        this->m_agentType.swap(other->m_agentType);
+        SwapValue(this->m_id, other->m_id);
+
+        this->m_preconditions.swap(other->m_preconditions);
+        this->m_effectors.swap(other->m_effectors);
+        this->m_events.swap(other->m_events);
+
+        this->m_enterPreconds.swap(other->m_enterPreconds);
+        this->m_updatePreconds.swap(other->m_updatePreconds);
+        this->m_successEffectors.swap(other->m_successEffectors);
+        this->m_failureEffectors.swap(other->m_failureEffectors);
+
+        SwapValue(this->m_attachments, other->m_attachments);
+        SwapValue(this->m_pars, other->m_pars);
+        SwapValue(this->m_children, other->m_children);
+        SwapValue(this->m_customCondition, other->m_customCondition);
+        SwapValue(this->m_enterAction, other->m_enterAction);
+        SwapValue(this->m_exitAction, other->m_exitAction);
+        SwapValue(this->m_bHasEvents, other->m_bHasEvents);
+        SwapValue(this->m_contentHash, other->m_contentHash);
+        this->m_sharingContent.swap(other->m_sharingContent);
+        SwapValue(this->m_bIsFSM, other->m_bIsFSM);
+        this->m_nodeIds.swap(other->m_nodeIds);
+        this->m_taskIndices.swap(other->m_taskIndices);
+        SwapValue(this->m_indexedTasksCount, other->m_indexedTasksCount);
+
+        this->m_domains.swap(other->m_domains);
+        SwapValue(this->m_pMapping, other->m_pMapping);
+        SwapValue(this->m_mappingSize, other->m_mappingSize);
+
+        //the children are reparented to the trees holding them now
+        BehaviorTree* trees[2] = { this, other };
+
+        for (int t = 0; t < 2; ++t)
+        {
+            if (trees[t]->m_children)
+            {
+                for (size_t i = 0; i < trees[t]->m_children->size(); ++i)
+                {
+                    (*trees[t]->m_children)[i]->m_parent = trees[t];
+                }
+            }
+        }
     }
 
     //
@@ -823,6 +1284,74 @@ namespace behaviac
         m_bIsFSM = isFsm;
     }
 
+    void BehaviorTree::ShareSubtrees()
+    {
+        this->m_nodeIds.clear();
+
+        if (this->m_bIsFSM || !this->IsSharableSubtree())
+        {
+            return;
+        }
+
+        //the ids are collected before the children are replaced by the shared ones of other ids
+        behaviac::vector<int> nodeIds;
+        this->CollectIds(nodeIds);
+
+        if (this->ShareChildren() > 0)
+        {
+            this->m_nodeIds.swap(nodeIds);
+        }
+    }
+
+    void BehaviorTree::IndexTasks()
+    {
+        this->m_taskIndices.clear();
+        this->m_indexedTasksCount = 0;
+
+        //the nodes are walked as their tasks are created, the ids might be remapped, see ShareSubtrees
+        behaviac::vector<int> ids;
+        uint32_t index = 0;
+        this->CollectTaskIds(this->m_nodeIds, index, ids);
+
+        //the ids are numbered from 0 in a tree, the ones too sparse are not indexed
+        const int kMaxId = (int)ids.size() * 4 + 256;
+        behaviac::vector<int> taskIndices;
+
+        for (uint32_t i = 0; i < ids.size(); ++i)
+        {
+            int id = ids[i];
+
+            if (id < 0)
+            {
+                continue;
+            }
+
+            if (id >= kMaxId)
+            {
+                taskIndices.clear();
+                break;
+            }
+
+            if (id >= (int)taskIndices.size())
+            {
+                taskIndices.resize(id + 1, -1);
+            }
+
+            //the first one is the one found by walking the tasks
+            if (taskIndices[id] == -1)
+            {
+                taskIndices[id] = (int)i;
+            }
+        }
+
+        this->m_taskIndices.swap(taskIndices);
+
+        if (!this->m_taskIndices.empty())
+        {
+            this->m_indexedTasksCount = (uint32_t)ids.size();
+        }
+    }
+
     void BehaviorNode::load_par(int version, const char* agentType, rapidxml::xml_node<>* node)
     {
         BEHAVIAC_UNUSED_VAR(version);
@@ -873,6 +1402,7 @@ namespace behaviac
                             rapidxml::xml_node<>*  customNode = (rapidxml::xml_node<>*)c->first_node(kStrNode);
                             BehaviorNode* pChildNode = BehaviorNode::load(agentType, customNode, version);
                             this->m_customCondition = pChildNode;
+                            this->CombineHash(pChildNode);
 
                         }
                         else if (StringUtils::StrEqual(c->name(), kStrNode))
@@ -896,6 +1426,7 @@ namespace behaviac
 
             if (properties.size() > 0)
             {
+                this->CombineHash(properties);
                 this->load(version, agentType, properties);
                 //this->load(version, agentType, properties);
             }
@@ -957,6 +1488,8 @@ namespace behaviac
             pAttachment->load_properties_pars_attachments_children(false, version, agentType, c);
 
             this->Attach(pAttachment, bIsPrecondition, bIsEffector, bIsTransition);
+            this->CombineHash(pAttachment);
+            this->CombineHash(flagStr);
 
             bHasEvents |= (Event::DynamicCast(pAttachment) != 0);
         }
@@ -1045,7 +1578,7 @@ namespace behaviac
     void BehaviorNode::load_properties(int version, const char* agentType, BsonDeserizer& d)
     {
 #if !BEHAVIAC_RELEASE
-        this->m_agentType = agentType;
+        this->m_agentType.Set(agentType);
 #endif
         d.OpenDocument();
 
@@ -1067,6 +1600,7 @@ namespace behaviac
 
         if (properties.size() > 0)
         {
+            this->CombineHash(properties);
             this->load(version, agentType, properties);
         }
 
@@ -1106,6 +1640,7 @@ namespace behaviac
 
         BehaviorNode* pChildNode = this->load(agentType, d, version);
         this->m_customCondition = pChildNode;
+        this->CombineHash(pChildNode);
 
         d.CloseDocument(false);
 
@@ -1212,6 +1747,8 @@ namespace behaviac
                         pAttachment->load_properties_pars_attachments_children(version, agentType, d, bAttachmentIsTransition);
 
                         this->Attach(pAttachment, bIsPrecondition, bIsEffector, bAttachmentIsTransition);
+                        this->CombineHash(pAttachment);
+                        this->CombineHash((uint32_t)((bIsPrecondition ? 1 : 0) | (bIsEffector ? 2 : 0) | (bAttachmentIsTransition ? 4 : 0)));
 
                         this->m_bHasEvents |= (Event::DynamicCast(pAttachment) != 0); //(pAttachment is Event);
                     }
@@ -1297,6 +1834,11 @@ namespace behaviac
         doc.parse<0>(pBuffer);
         rapidxml::xml_node<>* behaviorNode = doc.first_node(kStrBehavior);//SecurityElement BehaviorNode* = xmlDoc.ToXml();
 
+        return this->load_xml(behaviorNode);
+    }
+
+    bool BehaviorTree::load_xml(rapidxml::xml_node<>* behaviorNode)
+    {
         //if (behaviorNode.Tag != "behavior" && (behaviorNode.Children == NULL || behaviorNode.Children.Count != 1))
         //{
         //	return false;
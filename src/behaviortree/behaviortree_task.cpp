@@ -44,12 +44,14 @@ END_ENUM_DESCRIPTION()
 
 namespace behaviac
 {
-    BehaviorTask::BehaviorTask() : m_status(BT_INVALID), m_node(0), m_parent(0), m_attachments(0)
+    BehaviorTask::BehaviorTask() : m_status(BT_INVALID), m_node(0), m_parent(0), m_attachments(0), m_eventAgent(0),
+        m_topManageBranch(0), m_bTopManageBranchResolved(false)
     {
     }
 
     BehaviorTask::~BehaviorTask()
     {
+        this->UnsubscribeEvents();
         this->FreeAttachments();
     }
 
@@ -71,8 +73,9 @@ namespace behaviac
 
     void BehaviorTask::Clear()
     {
+        this->UnsubscribeEvents();
         this->m_status = BT_INVALID;
-        this->m_parent = 0;
+        this->SetParent(0);
         this->m_id = -1;
         this->FreeAttachments();
 
@@ -132,15 +135,88 @@ namespace behaviac
 		return -1;
 	}
 
-    const behaviac::string& BehaviorTask::GetClassNameString() const
+    bool BehaviorTask::rebind(const BehaviorNode* node)
+    {
+        BEHAVIAC_ASSERT(node);
+
+        if (this->m_node == 0 || !this->m_node->IsSameContent(node))
+        {
+            return false;
+        }
+
+        //the attachment tasks are created in the order of the node's attachments in Init
+        uint32_t attachmentsCount = this->m_attachments ? this->m_attachments->size() : 0;
+
+        if (attachmentsCount != node->GetAttachmentsCount())
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < attachmentsCount; ++i)
+        {
+            BehaviorTask* pAttachment = (*this->m_attachments)[i];
+            const BehaviorNode* attachmentNode = node->GetAttachment(i);
+
+            //the task's id might be remapped, see remapids
+            if (pAttachment->m_node->GetId() != attachmentNode->GetId())
+            {
+                return false;
+            }
+
+            pAttachment->m_node = attachmentNode;
+        }
+
+        this->m_node = node;
+
+        return true;
+    }
+
+    void BehaviorTask::collectids(behaviac::vector<int>& ids) const
+    {
+        ids.push_back(this->m_id);
+
+        if (this->m_attachments)
+        {
+            for (uint32_t i = 0; i < this->m_attachments->size(); ++i)
+            {
+                (*this->m_attachments)[i]->collectids(ids);
+            }
+        }
+    }
+
+    void BehaviorTask::remapids(const behaviac::vector<int>& ids, uint32_t& index)
+    {
+        BEHAVIAC_ASSERT(index < ids.size());
+
+        if (index < ids.size())
+        {
+            this->m_id = ids[index];
+        }
+
+        index++;
+
+        if (this->m_attachments)
+        {
+            for (uint32_t i = 0; i < this->m_attachments->size(); ++i)
+            {
+                (*this->m_attachments)[i]->remapids(ids, index);
+            }
+        }
+    }
+
+    void BehaviorTask::collecttasks(behaviac::vector<BehaviorTask*>& tasks)
+    {
+        tasks.push_back(this);
+    }
+
+    const char* BehaviorTask::GetClassNameString() const
     {
         if (this->m_node)
         {
             return this->m_node->GetClassNameString();
         }
 
-        static behaviac::string s_subBT("SubBT");
-        return s_subBT;
+        return "SubBT";
     }
 
     int BehaviorTask::GetId() const
@@ -171,125 +247,38 @@ namespace behaviac
         return true;
     }
 
-    //max number of threads used for BT ticking.
-    //usually, only 1 thread is used for BT ticking.
-    const static int kMaxThreads = 32;
-
-    struct ThreadStatus_t
-    {
-        THREAD_ID_TYPE	tid_;
-        EBTStatus		status_;
-        int				nodeId_;
-    };
-
-    //thread safe and no more mutex or memory allocation
-    //
-    static behaviac::Mutex* gs_tickingMutex = 0;
-    static ThreadStatus_t gs_lastStatus[kMaxThreads];
-
-    static behaviac::Mutex& GetTickingMutex()
-    {
-        if (!gs_tickingMutex)
-        {
-            gs_tickingMutex = BEHAVIAC_NEW behaviac::Mutex;
-        }
-
-        return *gs_tickingMutex;
-    }
-
-    void CleanupTickingMutex()
-    {
-        BEHAVIAC_DELETE gs_tickingMutex;
-        gs_tickingMutex = 0;
-    }
+    //the node being executed by each thread, the contexts sharing the loaded trees can be executed on separate threads
+#if BEHAVIAC_COMPILER_MSVC
+    static __declspec(thread) int t_nodeId = INVALID_NODE_ID;
+#else
+    static __thread int t_nodeId = INVALID_NODE_ID;
+#endif
 
     EBTStatus GetNodeExitStatus()
     {
-        THREAD_ID_TYPE tid = behaviac::GetTID();
-
-        {
-            behaviac::ScopedLock lock(GetTickingMutex());
-
-            for (int i = 0; i < kMaxThreads; ++i)
-            {
-                const ThreadStatus_t& ts = gs_lastStatus[i];
-
-                if (ts.tid_ == tid)
-                {
-                    return ts.status_;
-                }
-            }
-        }
-
-        BEHAVIAC_ASSERT(false, "this function is only valid when it is called instead of an 'ExitAction' of any Node.\n \
-							   							   							   							   							   							   							   							   							   							   							   							   							   			it should not be called in any other functions!");
+        BEHAVIAC_ASSERT(t_nodeId != INVALID_NODE_ID, "this function is only valid when it is called instead of an 'ExitAction' of any Node.\n \
+			it should not be called in any other functions!");
 
         return BT_INVALID;
     }
 
     int SetNodeId(int nodeId)
     {
-        THREAD_ID_TYPE tid = behaviac::GetTID();
-
-        int slot = -1;
-        {
-            behaviac::ScopedLock lock(GetTickingMutex());
-
-            for (int i = 0; i < kMaxThreads; ++i)
-            {
-                ThreadStatus_t& ts = gs_lastStatus[i];
-
-                if (ts.tid_ == 0)
-                {
-                    ts.tid_ = tid;
-                    ts.nodeId_ = nodeId;
-                    slot = i;
+        int previousId = t_nodeId;
 
-                    break;
-                }
-            }
-        }
+        t_nodeId = nodeId;
 
-        return slot;
+        return previousId;
     }
 
-    void ClearNodeId(int slot)
+    void RestoreNodeId(int previousId)
     {
-        THREAD_ID_TYPE tid = behaviac::GetTID();
-
-        BEHAVIAC_UNUSED_VAR(tid);
-        {
-            behaviac::ScopedLock lock(GetTickingMutex());
-
-            ThreadStatus_t& ts = gs_lastStatus[slot];
-            BEHAVIAC_ASSERT(ts.tid_ == tid);
-
-            ts.tid_ = 0;
-            ts.nodeId_ = INVALID_NODE_ID;
-        }
+        t_nodeId = previousId;
     }
 
     int GetNodeId()
     {
-        THREAD_ID_TYPE tid = behaviac::GetTID();
-
-        {
-            behaviac::ScopedLock lock(GetTickingMutex());
-
-            for (int i = 0; i < kMaxThreads; ++i)
-            {
-                const ThreadStatus_t& ts = gs_lastStatus[i];
-
-                if (ts.tid_ == tid)
-                {
-                    return ts.nodeId_;
-                }
-            }
-        }
-
-        //BEHAVIAC_ASSERT(false, "this function is only valid when it is called instead of an 'Action' Node.\n");
-
-        return INVALID_NODE_ID;
+        return t_nodeId;
     }
 
     EBTStatus BehaviorTask::update(Agent* pAgent, EBTStatus childStatus)
@@ -312,23 +301,30 @@ namespace behaviac
     }
 
 #if !defined(BEHAVIAC_RELEASE)
+    static behaviac::string MakeTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorNode* n, int nodeId, const char* action);
+
     behaviac::string BehaviorTask::GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorTask* b, const char* action)
     {
-        return BehaviorTask::GetTickInfo(pAgent, b->GetNode(), action);
+        //the task's id is the one in its own tree even if its node is shared by other trees
+        return MakeTickInfo(pAgent, b->GetNode(), b->GetId(), action);
     }
 
     behaviac::string BehaviorTask::GetTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorNode* n, const char* action)
+    {
+        return MakeTickInfo(pAgent, n, n->GetId(), action);
+    }
+
+    static behaviac::string MakeTickInfo(const behaviac::Agent* pAgent, const behaviac::BehaviorNode* n, int nodeId, const char* action)
     {
         if (pAgent && pAgent->IsMasked())
         {
             //BEHAVIAC_PROFILE("GetTickInfo", true);
 
-            const behaviac::string& bClassName = n->GetClassNameString();
+            const char* bClassName = n->GetClassNameString();
 
             //filter out intermediate bt, whose class name is empty
-            if (!bClassName.empty())
+            if (bClassName[0] != '\0')
             {
-                int nodeId = n->GetId();
                 const BehaviorTreeTask* bt = pAgent ? pAgent->btgetcurrent() : 0;
 
                 //TestBehaviorGroup\scratch.xml->EventetTask[0]:enter
@@ -341,7 +337,7 @@ namespace behaviac
                     bpstr = FormatString("%s.xml->", btName.c_str());
                 }
 
-                bpstr += FormatString("%s[%i]", bClassName.c_str(), nodeId);
+                bpstr += FormatString("%s[%i]", bClassName, nodeId);
 
                 if (action)
                 {
@@ -367,7 +363,9 @@ namespace behaviac
     }
 
     //CheckBreakpoint should be after log of onenter/onexit/update, as it needs to flush msg to the client
-	void CHECK_BREAKPOINT(Agent* pAgent, const BehaviorNode* b, const char* action, EActionResult actionResult)
+	//'b' is either a node or a task, a task is identified by its id in its own tree even if its node is shared
+	template<typename T>
+	static void CheckBreakpoint_(Agent* pAgent, const T* b, const char* action, EActionResult actionResult)
 	{
 		if (Config::IsLoggingOrSocketing())
 		{
@@ -396,6 +394,16 @@ namespace behaviac
 			}
 		}
 	}
+
+	void CHECK_BREAKPOINT(Agent* pAgent, const BehaviorNode* b, const char* action, EActionResult actionResult)
+	{
+		CheckBreakpoint_(pAgent, b, action, actionResult);
+	}
+
+	static void CHECK_BREAKPOINT(Agent* pAgent, const BehaviorTask* b, const char* action, EActionResult actionResult)
+	{
+		CheckBreakpoint_(pAgent, b, action, actionResult);
+	}
 #else
 	void CHECK_BREAKPOINT(Agent* pAgent, const BehaviorNode* b, const char* action, EActionResult actionResult)
 	{
@@ -404,6 +412,14 @@ namespace behaviac
         BEHAVIAC_UNUSED_VAR(action);
         BEHAVIAC_UNUSED_VAR(actionResult);
 	}
+
+	static void CHECK_BREAKPOINT(Agent* pAgent, const BehaviorTask* b, const char* action, EActionResult actionResult)
+	{
+        BEHAVIAC_UNUSED_VAR(pAgent);
+        BEHAVIAC_UNUSED_VAR(b);
+        BEHAVIAC_UNUSED_VAR(action);
+        BEHAVIAC_UNUSED_VAR(actionResult);
+	}
 #endif//#if !defined(BEHAVIAC_RELEASE)
 
     bool BehaviorTask::onenter_action(Agent* pAgent)
@@ -424,7 +440,7 @@ namespace behaviac
 #if !BEHAVIAC_RELEASE
                 //BEHAVIAC_PROFILE_DEBUGBLOCK("Debug", true);
 
-                CHECK_BREAKPOINT(pAgent, this->m_node, "enter", bResult ? EAR_success : EAR_failure);
+                CHECK_BREAKPOINT(pAgent, this, "enter", bResult ? EAR_success : EAR_failure);
 #endif
             }
         }
@@ -437,16 +453,15 @@ namespace behaviac
 
         if (m_node != 0)
         {
-            if (m_node->m_preconditions.size() > 0)
-            {
-                bResult = ((BehaviorNode*)m_node)->CheckPreconditions(pAgent, bIsAlive);
-            }
+            bResult = m_node->CheckPreconditions(pAgent, bIsAlive);
         }
 
         return bResult;
     }
     void BehaviorTask::onexit_action(Agent* pAgent, EBTStatus status)
     {
+        this->UnsubscribeEvents();
+
         this->onexit(pAgent, status);
 
         if (this->m_node != 0)
@@ -475,12 +490,12 @@ namespace behaviac
             //BEHAVIAC_PROFILE_DEBUGBLOCK("Debug", true);
             if (status == BT_SUCCESS)
             {
-                CHECK_BREAKPOINT(pAgent, this->m_node, "exit", EAR_success);
+                CHECK_BREAKPOINT(pAgent, this, "exit", EAR_success);
 
             }
             else
             {
-                CHECK_BREAKPOINT(pAgent, this->m_node, "exit", EAR_failure);
+                CHECK_BREAKPOINT(pAgent, this, "exit", EAR_failure);
             }
         }
 
@@ -492,6 +507,12 @@ namespace behaviac
     */
     BranchTask* BehaviorTask::GetTopManageBranchTask()
     {
+        //a running leaf is exec'ed on every tick, so don't walk up its ancestors each time
+        if (this->m_bTopManageBranchResolved)
+        {
+            return this->m_topManageBranch;
+        }
+
         BranchTask* tree = 0;
         BehaviorTask* task = this->m_parent;
 
@@ -524,6 +545,9 @@ namespace behaviac
             task = task->m_parent;
         }
 
+        this->m_topManageBranch = tree;
+        this->m_bTopManageBranchResolved = true;
+
         return tree;
     }
 
@@ -574,13 +598,13 @@ namespace behaviac
     {
 #if BEHAVIAC_ENABLE_PROFILING
 #if 1
-        const char* classStr = (this->m_node ? this->m_node->GetClassNameString().c_str() : "BT");
-        int nodeId = (this->m_node ? this->m_node->GetId() : -1);
+        const char* classStr = (this->m_node ? this->m_node->GetClassNameString() : "BT");
+        int nodeId = this->GetId();
         behaviac::string taskClassid = FormatString("%s[%i]", classStr, nodeId);
 
         AutoProfileBlockSend profiler_block(Profiler::GetInstance(), taskClassid, pAgent);
 #else
-        const char* classStr = (this->m_node ? this->m_node->GetClassNameString().c_str() : "BT");
+        const char* classStr = (this->m_node ? this->m_node->GetClassNameString() : "BT");
         BEHAVIAC_PROFILE(classStr);
 #endif
 #endif//#if BEHAVIAC_ENABLE_PROFILING
@@ -619,13 +643,7 @@ namespace behaviac
             }
 
 #endif
-            bool bValid = true;
-            int _tempPrecndCount = this->m_node != 0 ? this->m_node->PreconditionsCount() : 0;
-
-            if (_tempPrecndCount > 0)
-            {
-                bValid = this->m_node->CheckPreconditions(pAgent, true);
-            }
+            bool bValid = this->m_node == 0 || this->m_node->CheckPreconditions(pAgent, true);
 
             if (bValid)
             {
@@ -648,6 +666,8 @@ namespace behaviac
             }
             else
             {
+                this->SubscribeEvents(pAgent);
+
                 BranchTask* tree = this->GetTopManageBranchTask();
 
                 if (tree != 0)
@@ -686,6 +706,8 @@ namespace behaviac
         BEHAVIAC_UNUSED_VAR(user_data);
         BEHAVIAC_UNUSED_VAR(pAgent);
 
+        node->UnsubscribeEvents();
+
         node->m_status = BT_INVALID;
 
         node->SetCurrentTask(0);
@@ -695,6 +717,46 @@ namespace behaviac
         return true;
     }
 
+    bool subscribeevents_handler(BehaviorTask* node, Agent* pAgent, void* user_data)
+    {
+        BEHAVIAC_UNUSED_VAR(user_data);
+
+        if (node->m_status == BT_RUNNING)
+        {
+            node->SubscribeEvents(pAgent);
+        }
+
+        return true;
+    }
+
+    void BehaviorTask::SubscribeEvents(Agent* pAgent)
+    {
+        if (this->m_eventAgent == 0 && this->m_node != 0 && this->m_node->m_events.size() > 0)
+        {
+            for (uint32_t i = 0; i < this->m_node->m_events.size(); ++i)
+            {
+                Event* pE = Event::DynamicCast(this->m_node->m_events[i]);
+
+                if (pE != 0 && pE->GetEventId().IsValid())
+                {
+                    pAgent->AddEventListener(pE->GetEventId(), this, i);
+                }
+            }
+
+            this->m_eventAgent = pAgent;
+        }
+    }
+
+    void BehaviorTask::UnsubscribeEvents()
+    {
+        if (this->m_eventAgent != 0)
+        {
+            //the node might have been reloaded already, so the agent looks it up by the task
+            this->m_eventAgent->RemoveEventListener(this);
+            this->m_eventAgent = 0;
+        }
+    }
+
     void BehaviorTask::abort(Agent* pAgent)
     {
         this->traverse(&abort_handler, pAgent, 0);
@@ -834,7 +896,7 @@ namespace behaviac
         if (this->m_status != BT_INVALID)
         {
             CSerializationID  classId("class");
-            node->setAttr(classId, this->GetClassNameString());
+            node->setAttrRaw(classId, this->GetClassNameString());
 
             CSerializationID  idId("id");
             node->setAttr(idId, this->GetId());
@@ -1201,6 +1263,74 @@ namespace behaviac
 		return 0;
 	}
 
+    bool CompositeTask::rebind(const BehaviorNode* node)
+    {
+        if (!super::rebind(node))
+        {
+            return false;
+        }
+
+        //the children ids are the same, so m_activeChildIndex is still valid
+        for (size_t i = 0; i < this->m_children.size(); ++i)
+        {
+            BehaviorTask* pChild = this->m_children[i];
+            const BehaviorNode* childNode = node->GetChild(i);
+
+            if (!pChild->rebind(childNode))
+            {
+                if (pChild->GetStatus() == BT_RUNNING)
+                {
+                    //the ancestors' current task might be in a running child, it can't be replaced,
+                    //unless the child is managed as a sub tree keeping its own current task, then it is restarted
+                    if (!node->IsManagingChildrenAsSubTrees())
+                    {
+                        return false;
+                    }
+
+                    pChild->reset(0);
+                }
+
+                BehaviorTask* childTask = childNode->CreateAndInitTask();
+                childTask->SetParent(this);
+                this->m_children[i] = childTask;
+
+                BehaviorTask::DestroyTask(pChild);
+            }
+        }
+
+        return true;
+    }
+
+    void CompositeTask::collectids(behaviac::vector<int>& ids) const
+    {
+        super::collectids(ids);
+
+        for (size_t i = 0; i < this->m_children.size(); ++i)
+        {
+            this->m_children[i]->collectids(ids);
+        }
+    }
+
+    void CompositeTask::remapids(const behaviac::vector<int>& ids, uint32_t& index)
+    {
+        super::remapids(ids, index);
+
+        for (size_t i = 0; i < this->m_children.size(); ++i)
+        {
+            this->m_children[i]->remapids(ids, index);
+        }
+    }
+
+    void CompositeTask::collecttasks(behaviac::vector<BehaviorTask*>& tasks)
+    {
+        super::collecttasks(tasks);
+
+        for (size_t i = 0; i < this->m_children.size(); ++i)
+        {
+            this->m_children[i]->collecttasks(tasks);
+        }
+    }
+
     const BehaviorTask* CompositeTask::GetTaskById(int id) const
     {
         BEHAVIAC_ASSERT(id != -1);
@@ -1273,6 +1403,59 @@ namespace behaviac
         }
     }
 
+    bool SingeChildTask::rebind(const BehaviorNode* node)
+    {
+        if (!super::rebind(node))
+        {
+            return false;
+        }
+
+        if (this->m_root && !this->m_root->rebind(node->GetChild(0)))
+        {
+            if (this->m_root->GetStatus() == BT_RUNNING)
+            {
+                return false;
+            }
+
+            BehaviorTask* pRoot = this->m_root;
+            this->addChild(node->GetChild(0)->CreateAndInitTask());
+
+            BehaviorTask::DestroyTask(pRoot);
+        }
+
+        return true;
+    }
+
+    void SingeChildTask::collectids(behaviac::vector<int>& ids) const
+    {
+        super::collectids(ids);
+
+        if (this->m_root)
+        {
+            this->m_root->collectids(ids);
+        }
+    }
+
+    void SingeChildTask::remapids(const behaviac::vector<int>& ids, uint32_t& index)
+    {
+        super::remapids(ids, index);
+
+        if (this->m_root)
+        {
+            this->m_root->remapids(ids, index);
+        }
+    }
+
+    void SingeChildTask::collecttasks(behaviac::vector<BehaviorTask*>& tasks)
+    {
+        super::collecttasks(tasks);
+
+        if (this->m_root)
+        {
+            this->m_root->collecttasks(tasks);
+        }
+    }
+
     void SingeChildTask::Init(const BehaviorNode* node)
     {
         super::Init(node);
@@ -1469,7 +1652,7 @@ namespace behaviac
         handler(this, pAgent, user_data);
     }
 
-    BehaviorTreeTask::BehaviorTreeTask() : SingeChildTask()
+    BehaviorTreeTask::BehaviorTreeTask() : SingeChildTask(), m_bEventListenersRestored(true)
     {}
 
     void BehaviorTreeTask::Init(const BehaviorNode* node)
@@ -1478,6 +1661,61 @@ namespace behaviac
         // BehaviorTree* tree = (BehaviorTree*)node;
 
 		super::Init(node);
+
+        this->RemapIds();
+        this->IndexTasks();
+    }
+
+    void BehaviorTreeTask::RemapIds()
+    {
+        const BehaviorTree* tree = (const BehaviorTree*)this->m_node;
+
+        if (!tree->m_nodeIds.empty())
+        {
+            uint32_t index = 0;
+            this->remapids(tree->m_nodeIds, index);
+            BEHAVIAC_ASSERT(index == tree->m_nodeIds.size());
+        }
+    }
+
+    void BehaviorTreeTask::IndexTasks()
+    {
+        const BehaviorTree* tree = (const BehaviorTree*)this->m_node;
+
+        this->m_tasks.clear();
+
+        if (!tree->m_taskIndices.empty())
+        {
+            this->collecttasks(this->m_tasks);
+
+            //the tasks are not created for each child node, look them up by walking the tasks
+            if (this->m_tasks.size() != tree->m_indexedTasksCount)
+            {
+                this->m_tasks.clear();
+            }
+        }
+    }
+
+    const BehaviorTask* BehaviorTreeTask::GetTaskById(int id) const
+    {
+        BEHAVIAC_ASSERT(id != -1);
+
+        if (!this->m_tasks.empty())
+        {
+            const behaviac::vector<int>& taskIndices = ((const BehaviorTree*)this->m_node)->m_taskIndices;
+
+            if (id < 0 || id >= (int)taskIndices.size() || taskIndices[id] == -1)
+            {
+                return 0;
+            }
+
+            BEHAVIAC_ASSERT(taskIndices[id] < (int)this->m_tasks.size());
+            BEHAVIAC_ASSERT(this->m_tasks[taskIndices[id]]->GetId() == id);
+
+            return this->m_tasks[taskIndices[id]];
+        }
+
+        return super::GetTaskById(id);
     }
 
     void BehaviorTreeTask::copyto(BehaviorTask* target) const
@@ -1512,10 +1750,34 @@ namespace behaviac
 
         BEHAVIAC_DELETE this->m_root;
         this->m_root = 0;
+        this->m_tasks.clear();
 
         this->m_currentTask = 0;
     }
 
+    bool BehaviorTreeTask::Rebind(const BehaviorTree* previous)
+    {
+        //the tree node is reloaded in place, the tasks still refer to the nodes held by 'previous'
+        const BehaviorNode* pTree = this->m_node;
+        BEHAVIAC_ASSERT(pTree && pTree != previous);
+
+        this->m_node = previous;
+
+        if (this->rebind(pTree))
+        {
+            this->RemapIds();
+
+            //the changed children are recreated
+            this->IndexTasks();
+
+            return true;
+        }
+
+        this->m_node = pTree;
+
+        return false;
+    }
+
     const behaviac::string& BehaviorTreeTask::GetName() const
     {
         BEHAVIAC_ASSERT(BehaviorTree::DynamicCast(this->m_node));
@@ -1585,6 +1847,18 @@ namespace behaviac
     void BehaviorTreeTask::CopyTo(BehaviorTreeTask* target)
     {
         this->copyto(target);
+
+        target->m_bEventListenersRestored = false;
+    }
+
+    void BehaviorTreeTask::RestoreEventListeners(Agent* pAgent)
+    {
+        if (!this->m_bEventListenersRestored)
+        {
+            this->traverse(&subscribeevents_handler, pAgent, 0);
+
+            this->m_bEventListenersRestored = true;
+        }
     }
 
     EBTStatus BehaviorTreeTask::resume(Agent* pAgent, EBTStatus status)
@@ -1704,5 +1978,7 @@ namespace behaviac
     void BehaviorTreeTask::Load(ISerializableNode* node)
     {
         this->load(node);
+
+        this->m_bEventListenersRestored = false;
     }
 }//namespace behaviac
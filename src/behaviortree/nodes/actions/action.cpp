@@ -19,7 +19,7 @@
 
 namespace behaviac
 {
-    Action::Action() : m_method(0), m_resultOption(BT_INVALID), m_resultFunctor(0)
+    Action::Action() : m_method(0), m_resultOption(BT_INVALID), m_resultFunctor(0), m_bStatusResult(false)
     {
     }
 
@@ -254,6 +254,10 @@ namespace behaviac
                 //BEHAVIAC_ASSERT(0, "unrecognised property %s", p.name);
             }
         }
+
+        //such a method is called with the result as its return value, no IAsyncValue is involved
+        this->m_bStatusResult = this->m_method && this->m_resultOption == BT_INVALID && !this->m_resultFunctor &&
+                                !this->m_method->HasCheckReturn() && this->m_method->IsReturnType<EBTStatus>();
     }
 
     bool Action::IsValid(Agent* pAgent, BehaviorTask* pTask) const
@@ -274,10 +278,26 @@ namespace behaviac
     }
 
     int SetNodeId(int nodeId);
-    void ClearNodeId(int slot);
+    void RestoreNodeId(int previousId);
 
     //Execute(Agent* pAgent)method hava be change to Execute(Agent* pAgent, EBTStatus childStatus)
     EBTStatus Action::Execute(const Agent* pAgent, EBTStatus childStatus)
+    {
+        return this->Execute(pAgent, childStatus, 0);
+    }
+
+    behaviac::IAsyncValue* Action::CreateReturnValue() const
+    {
+        //the return value is not needed when the result option is specified or the status is returned directly
+        if (this->m_method && this->m_resultOption == BT_INVALID && !this->m_bStatusResult)
+        {
+            return this->m_method->CreateReturnValue();
+        }
+
+        return 0;
+    }
+
+    EBTStatus Action::Execute(const Agent* pAgent, EBTStatus childStatus, behaviac::IAsyncValue* pReturn)
     {
         EBTStatus result = BT_SUCCESS;
 
@@ -288,11 +308,29 @@ namespace behaviac
             //#endif
             int nodeId = this->GetId();
 
-            int slot = SetNodeId(nodeId);
-            BEHAVIAC_ASSERT(slot != -1, "no empty slot found!");
+            int previousId = SetNodeId(nodeId);
 
             const Agent* pParent = this->m_method->GetParentAgent(pAgent);
-            this->m_method->run(pParent, pAgent);
+
+            if (this->m_bStatusResult)
+            {
+                this->m_method->Call(pParent, pAgent, &result);
+
+                RestoreNodeId(previousId);
+
+                return result;
+            }
+
+            //the method's own return value is shared by all the agents, so the caller's is used instead
+            behaviac::IAsyncValue* pTemp = 0;
+
+            if (!pReturn)
+            {
+                pTemp = this->CreateReturnValue();
+                pReturn = pTemp;
+            }
+
+            this->m_method->run(pParent, pAgent, pReturn);
 
             if (this->m_resultOption != BT_INVALID)
             {
@@ -303,15 +341,17 @@ namespace behaviac
             {
                 const Agent* pParentCheckResult = this->m_resultFunctor->GetParentAgent(pAgent);
 
-                result = (EBTStatus)this->m_method->CheckReturn(pParent, pParentCheckResult, this->m_resultFunctor);
+                result = (EBTStatus)this->m_method->CheckReturn(pParent, pReturn, pParentCheckResult, this->m_resultFunctor);
 
             }
             else
             {
-                this->m_method->CheckReturn(pParent, result);
+                this->m_method->CheckReturn(pParent, pReturn, result);
             }
 
-            ClearNodeId(slot);
+            BEHAVIAC_DELETE(pTemp);
+
+            RestoreNodeId(previousId);
 
         }
         else
@@ -325,12 +365,25 @@ namespace behaviac
         return result;
     }
 
-    ActionTask::ActionTask() : LeafTask()
+    ActionTask::ActionTask() : LeafTask(), m_return(0)
     {
     }
 
     ActionTask::~ActionTask()
     {
+        BEHAVIAC_DELETE(this->m_return);
+    }
+
+    void ActionTask::Init(const BehaviorNode* node)
+    {
+        super::Init(node);
+
+        BEHAVIAC_ASSERT(Action::DynamicCast(node));
+        const Action* pActionNode = (const Action*)node;
+
+        //each task keeps its own return value so that the agents sharing the tree don't share it
+        BEHAVIAC_DELETE(this->m_return);
+        this->m_return = pActionNode->CreateReturnValue();
     }
 
     void ActionTask::copyto(BehaviorTask* target) const
@@ -368,7 +421,7 @@ namespace behaviac
         BEHAVIAC_ASSERT(Action::DynamicCast(this->GetNode()));
         Action* pActionNode = (Action*)(this->GetNode());
 
-        EBTStatus result = pActionNode->Execute(pAgent, childStatus);
+        EBTStatus result = pActionNode->Execute(pAgent, childStatus, this->m_return);
 
         return result;
     }
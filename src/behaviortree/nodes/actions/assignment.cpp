@@ -16,13 +16,14 @@
 #include "behaviac/behaviortree/nodes/actions/assignment.h"
 #include "behaviac/base/core/profiler/profiler.h"
 #include "behaviac/base/object/method.h"
+#include "behaviac/property/comparator.h"
 
 #include "behaviac/behaviortree/nodes/actions/action.h"
 #include "behaviac/behaviortree/nodes/conditions/condition.h"
 
 namespace behaviac
 {
-    Assignment::Assignment() : m_opl(0), m_opr(0), m_opr_m(0)
+    Assignment::Assignment() : m_opl(0), m_opr(0), m_opr_m(0), m_assignment(0)
     {
     }
 
@@ -31,6 +32,7 @@ namespace behaviac
         BEHAVIAC_DELETE(m_opl);
         BEHAVIAC_DELETE(m_opr);
         BEHAVIAC_DELETE(m_opr_m);
+        BEHAVIAC_DELETE(m_assignment);
     }
 
     //CMethodBase* LoadMethod(const char* value);
@@ -45,6 +47,7 @@ namespace behaviac
         super::load(version, agentType, properties);
 
         behaviac::string propertyName;
+        behaviac::string typeName;
 
         for (propertie_const_iterator_t it = properties.begin(); it != properties.end(); ++it)
         {
@@ -52,7 +55,7 @@ namespace behaviac
 
             if (strcmp(p.name, "Opl") == 0)
             {
-                this->m_opl = Condition::LoadLeft(p.value);
+                this->m_opl = Condition::LoadLeft(p.value, typeName);
 
             }
             else if (strcmp(p.name, "Opr") == 0)
@@ -78,6 +81,23 @@ namespace behaviac
                 //BEHAVIAC_ASSERT(0, "unrecognised property %s", p.name);
             }
         }
+
+        //the right value is assigned as the type of the left one, the same as Property::SetFrom,
+        //a method returning another type (like a 'char*' to a string) is still assigned by SetFrom
+        bool bSameType = true;
+
+        if (this->m_opr_m)
+        {
+            behaviac::string returnTypeName;
+            this->m_opr_m->GetReturnTypeName(returnTypeName);
+
+            bSameType = (returnTypeName == typeName);
+        }
+
+        if (this->m_opl && (this->m_opr || this->m_opr_m) && bSameType)
+        {
+            this->m_assignment = Condition::CreateAssignment(typeName.c_str(), this->m_opl, this->m_opr, this->m_opr_m);
+        }
     }
     bool Assignment::EvaluteAssignment(const Agent* pAgent, Property* opl, Property* opr, CMethodBase* opr_m)
     {
@@ -175,7 +195,17 @@ namespace behaviac
         Assignment* pAssignmentNode = (Assignment*)(this->GetNode());
 
         EBTStatus result = BT_SUCCESS;
-        bool bValid = Assignment::EvaluteAssignment(pAgent, pAssignmentNode->m_opl, pAssignmentNode->m_opr, pAssignmentNode->m_opr_m);
+        bool bValid = false;
+
+        if (pAssignmentNode->m_assignment)
+        {
+            pAssignmentNode->m_assignment->Execute(pAgent);
+            bValid = true;
+        }
+        else
+        {
+            bValid = Assignment::EvaluteAssignment(pAgent, pAssignmentNode->m_opl, pAssignmentNode->m_opr, pAssignmentNode->m_opr_m);
+        }
 
         if (!bValid)
         {
@@ -61,7 +61,7 @@ namespace behaviac
         M_PRIMITIVE_NUMBER_TYPES();
     }
 
-    Compute::Compute() : m_opl(0), m_opr1(0), m_opr1_m(0), m_opr2(0), m_opr2_m(0), m_operator(ECO_INVALID)
+    Compute::Compute() : m_opl(0), m_opr1(0), m_opr1_m(0), m_opr2(0), m_opr2_m(0), m_operator(ECO_INVALID), m_computer(0)
     {
     }
 
@@ -73,6 +73,8 @@ namespace behaviac
 
         BEHAVIAC_DELETE(m_opr2);
         BEHAVIAC_DELETE(m_opr2_m);
+
+        BEHAVIAC_DELETE(m_computer);
     }
 
     ////CMethodBase* LoadMethod(const char* value);
@@ -155,6 +157,23 @@ namespace behaviac
 
         BEHAVIAC_ASSERT(this->m_operator != ECO_INVALID);
         this->m_typeName = typeName;
+
+        if (this->m_opl && (this->m_opr1 || this->m_opr1_m) && (this->m_opr2 || this->m_opr2_m))
+        {
+            this->m_computer = Compute::Create(typeName.c_str(), this->m_opl, this->m_opr1, this->m_opr1_m, this->m_operator, this->m_opr2, this->m_opr2_m);
+        }
+    }
+
+    VariableComputer* Compute::Create(const char* typeName, Property* opl, Property* opr1, CMethodBase* opr1_m, EComputeOperator computeOperator, Property* opr2, CMethodBase* opr2_m)
+    {
+        VariableComparatorIterator it = Computers().find(typeName);
+
+        if (it != Computers().end() && it->second)
+        {
+            return it->second->Compile(opl, opr1, opr1_m, computeOperator, opr2, opr2_m);
+        }
+
+        return 0;
     }
 
     bool Compute::EvaluteCompute(Agent* pAgent, const behaviac::string& typeName, Property* opl, Property* opr1, CMethodBase* opr1_m, EComputeOperator computeOperator, Property* opr2, CMethodBase* opr2_m)
@@ -239,8 +258,17 @@ namespace behaviac
         BEHAVIAC_ASSERT(Compute::DynamicCast(this->GetNode()));
         Compute* pComputeNode = (Compute*)(this->GetNode());
 
-        bool bValid = Compute::EvaluteCompute(pAgent, pComputeNode->m_typeName, pComputeNode->m_opl, pComputeNode->m_opr1, pComputeNode->m_opr1_m,
-                                              pComputeNode->m_operator, pComputeNode->m_opr2, pComputeNode->m_opr2_m);
+        bool bValid = false;
+
+        if (pComputeNode->m_computer)
+        {
+            bValid = pComputeNode->m_computer->Execute(pAgent);
+        }
+        else
+        {
+            bValid = Compute::EvaluteCompute(pAgent, pComputeNode->m_typeName, pComputeNode->m_opl, pComputeNode->m_opr1, pComputeNode->m_opr1_m,
+                                             pComputeNode->m_operator, pComputeNode->m_opr2, pComputeNode->m_opr2_m);
+        }
 
         if (!bValid)
         {
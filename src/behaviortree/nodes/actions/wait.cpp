@@ -140,7 +140,7 @@ namespace behaviac
 
         if (this->GetIgnoreTimeScale())
         {
-            this->m_start = Workspace::GetInstance()->GetTimeSinceStartup() * 1000.0f;
+            this->m_start = Context::GetContext(pAgent->GetContextId()).GetTimeSinceStartup() * 1000.0f;
 
         }
         else
@@ -171,14 +171,14 @@ namespace behaviac
 
         if (this->GetIgnoreTimeScale())
         {
-            if (Workspace::GetInstance()->GetTimeSinceStartup() * 1000.0f - this->m_start >= this->m_time)
+            if (Context::GetContext(pAgent->GetContextId()).GetTimeSinceStartup() * 1000.0f - this->m_start >= this->m_time)
             {
                 return BT_SUCCESS;
             }
         }
         else
         {
-            this->m_start += Workspace::GetInstance()->GetDeltaFrameTime() * 1000.0f;
+            this->m_start += Context::GetContext(pAgent->GetContextId()).GetDeltaFrameTime() * 1000.0f;
 
             if (this->m_start >= this->m_time)
             {
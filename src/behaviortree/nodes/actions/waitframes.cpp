@@ -81,10 +81,8 @@ namespace behaviac
             BEHAVIAC_ASSERT(pParent);
             /*}*/
 
-            this->m_frames_method->run(pParent, pAgent);
-
             int frames = 0;
-            this->m_frames_method->GetReturnValue(pParent, frames);
+            this->m_frames_method->Invoke(pParent, pAgent, frames);
 
             return frames;
         }
@@ -182,7 +180,7 @@ namespace behaviac
         BEHAVIAC_UNUSED_VAR(pAgent);
         BEHAVIAC_UNUSED_VAR(childStatus);
 
-        this->m_start += (int)(Workspace::GetInstance()->GetDeltaFrames());
+        this->m_start += (int)(Context::GetContext(pAgent->GetContextId()).GetDeltaFrames());
 
         if (this->m_start >= this->m_frames)
         {
@@ -79,16 +79,11 @@ namespace behaviac
 
         if (method)
         {
-            //ParentType pt = method->GetParentType();
-            Agent* pParent = pAgent;
-            /*	if (pt == PT_INSTANCE)
-            	{*/
-            pParent = Agent::GetInstance(method->GetInstanceNameString(), pParent->GetContextId());
+            //a method of 'Self' is invoked on the agent itself, only the method of a named instance looks it up
+            const Agent* pParent = method->GetParentAgent(pAgent);
             BEHAVIAC_ASSERT(pParent);
-            //}
 
-            method->run(pParent, pAgent);
-            bool bOk = method->GetReturnValue(pParent, value);
+            bool bOk = method->Invoke(pParent, pAgent, value);
             BEHAVIAC_UNUSED_VAR(bOk);
 
         }
@@ -119,20 +114,22 @@ namespace behaviac
             this->m_set[i] = i;
         }
 
-        for (uint32_t i = 0; i < n; ++i)
+        //Fisher-Yates, a draw for each child but the first one, m_set is only resized when the children are changed
+        for (uint32_t i = n; i > 1; --i)
         {
-            uint32_t index1 = (uint32_t)(n * GetRandomValue(pNode ? pNode->m_method : 0, pAgent));
-            BEHAVIAC_ASSERT(index1 < n);
+            uint32_t index = (uint32_t)(i * GetRandomValue(pNode ? pNode->m_method : 0, pAgent));
 
-            uint32_t index2 = (uint32_t)(n * GetRandomValue(pNode ? pNode->m_method : 0, pAgent));
-            BEHAVIAC_ASSERT(index2 < n);
+            if (index >= i)
+            {
+                index = i - 1;
+            }
 
             //swap
-            if (index1 != index2)
+            if (index != i - 1)
             {
-                uint32_t old = this->m_set[index1];
-                this->m_set[index1] = this->m_set[index2];
-                this->m_set[index2] = old;
+                uint32_t old = this->m_set[index];
+                this->m_set[index] = this->m_set[i - 1];
+                this->m_set[i - 1] = old;
             }
         }
     }
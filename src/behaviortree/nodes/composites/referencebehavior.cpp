@@ -114,12 +114,12 @@ namespace behaviac
 
 			if (this->m_transitions == 0)
 			{
-				this->m_transitions = BEHAVIAC_NEW behaviac::vector<Transition*>();
+				this->m_transitions = BEHAVIAC_NEW TransitionTable();
 			}
 
 			BEHAVIAC_ASSERT(Transition::DynamicCast(pAttachment) != 0);
 			Transition* pTransition = (Transition*)pAttachment;
-			this->m_transitions->push_back(pTransition);
+			this->m_transitions->Add(pTransition);
 
 			return;
 		}
@@ -181,6 +181,11 @@ namespace behaviac
 
     ReferencedBehaviorTask::~ReferencedBehaviorTask()
     {
+        if (this->m_subTree)
+        {
+            Workspace::GetInstance()->DestroyBehaviorTreeTask(this->m_subTree, 0);
+            this->m_subTree = 0;
+        }
     }
 
     void ReferencedBehaviorTask::copyto(BehaviorTask* target) const
@@ -218,8 +223,19 @@ namespace behaviac
 
 		pNode->SetTaskParams(pAgent);
 
-		this->m_subTree = Workspace::GetInstance()->CreateBehaviorTreeTask(pNode->m_referencedBehaviorPath.c_str());
+		//the subtree task is created once and reused whenever this node is entered again
+		if (this->m_subTree == 0)
+		{
+			this->m_subTree = Workspace::GetInstance()->CreateBehaviorTreeTask(pNode->m_referencedBehaviorPath.c_str());
+		}
+		else
+		{
+			this->m_subTree->reset(pAgent);
+		}
+
+#if !BEHAVIAC_RELEASE
 
+		if (Config::IsLoggingOrSocketing())
 		{
 			const char* pThisTree = pAgent->btgetcurrent()->GetName().c_str();
 			const char* pReferencedTree = pNode->m_referencedBehaviorPath.c_str();
@@ -229,6 +245,8 @@ namespace behaviac
 			LogManager::GetInstance()->Log(pAgent, msg.c_str(), EAR_none, ELM_jump);
 		}
 
+#endif
+
         return true;
     }
 
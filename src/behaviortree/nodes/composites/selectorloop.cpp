@@ -14,6 +14,7 @@
 #include "behaviac/base/base.h"
 #include "behaviac/behaviortree/nodes/composites/selectorloop.h"
 #include "behaviac/behaviortree/nodes/composites/withprecondition.h"
+#include "behaviac/agent/agent.h"
 
 namespace behaviac
 {
@@ -105,6 +106,27 @@ namespace behaviac
         super::onexit(pAgent, s);
     }
 
+    bool SelectorLoopTask::IsCachingPreconditions(Agent* pAgent) const
+    {
+        //the planner reads and writes the variables in its own states, they are not tracked
+        if (pAgent->m_variables.Top() != -1)
+        {
+            return false;
+        }
+
+        for (const BehaviorTask* task = this->GetParent(); task != 0; task = task->GetParent())
+        {
+            if (BehaviorTreeTask::DynamicCast(task))
+            {
+                const BehaviorTree* pTree = (const BehaviorTree*)task->GetNode();
+
+                return pTree != 0 && pTree->IsPreconditionCaching();
+            }
+        }
+
+        return false;
+    }
+
 	EBTStatus SelectorLoopTask::update_current(Agent* pAgent, EBTStatus childStatus)
 	{
 		EBTStatus s = this->update(pAgent, childStatus);
@@ -141,15 +163,14 @@ namespace behaviac
 
         //checking the preconditions and take the first action tree
         uint32_t index = (uint32_t) - 1;
+        bool bCaching = this->IsCachingPreconditions(pAgent);
 
         for (uint32_t i = (idx + 1); i < this->m_children.size(); ++i)
         {
             WithPreconditionTask* pSubTree = (WithPreconditionTask*)this->m_children[i];
             BEHAVIAC_ASSERT(WithPreconditionTask::DynamicCast(pSubTree));
 
-            pSubTree->SetIsUpdatePrecondition(true);
-            EBTStatus status = pSubTree->exec(pAgent);
-            pSubTree->SetIsUpdatePrecondition(false);
+            EBTStatus status = pSubTree->UpdatePrecondition(pAgent, bCaching);
 
             if (status == BT_SUCCESS)
             {
@@ -176,9 +197,7 @@ namespace behaviac
 
                 if (i > index)
                 {
-                    pSubTree->SetIsUpdatePrecondition(true);
-                    EBTStatus status = pSubTree->exec(pAgent);
-                    pSubTree->SetIsUpdatePrecondition(false);
+                    EBTStatus status = pSubTree->UpdatePrecondition(pAgent, bCaching);
 
                     //to search for the first one whose precondition is success
                     if (status != BT_SUCCESS)
@@ -113,21 +113,7 @@ namespace behaviac
 
         BEHAVIAC_ASSERT(this->m_activeChildIndex == CompositeTask::InvalidChildIndex);
 
-        //const SelectorProbability* pSelectorProbabilityNode = SelectorProbability::DynamicCast(this->GetNode());
-
-        this->m_weightingMap.clear();
-        this->m_totalSum = 0;
-
-        for (BehaviorTasks_t::iterator it = this->m_children.begin(); it != this->m_children.end(); ++it)
-        {
-            BehaviorTask* task = *it;
-            BEHAVIAC_ASSERT(DecoratorWeightTask::DynamicCast(task));
-            DecoratorWeightTask* pWT = (DecoratorWeightTask*)task;
-
-            int weight = pWT->GetWeight(pAgent);
-            this->m_weightingMap.push_back(weight);
-            this->m_totalSum += weight;
-        }
+        this->UpdateWeights(pAgent);
 
         BEHAVIAC_ASSERT(this->m_weightingMap.size() == this->m_children.size());
 
@@ -165,37 +151,168 @@ namespace behaviac
 
         BEHAVIAC_ASSERT(this->m_weightingMap.size() == this->m_children.size());
 
-        //generate a number between 0 and the sum of the weights
-        double chosen = this->m_totalSum * GetRandomValue(pSelectorProbabilityNode->m_method, pAgent);
+        //generate a number between 0 and 1 and look up the child in the alias table
+        int i = this->SelectChild(GetRandomValue(pSelectorProbabilityNode->m_method, pAgent));
+
+        if (i >= 0)
+        {
+            BehaviorTask* pChild = this->m_children[i];
+
+            EBTStatus status = pChild->exec(pAgent);
 
-        double sum = 0;
+            if (status == BT_RUNNING)
+            {
+                this->m_activeChildIndex = i;
+
+            }
+            else
+            {
+                this->m_activeChildIndex = CompositeTask::InvalidChildIndex;
+            }
+
+            return status;
+        }
+
+        return BT_FAILURE;
+    }
 
-        for (uint32_t i = 0; i < this->m_children.size(); ++i)
+    void SelectorProbabilityTask::UpdateWeights(Agent* pAgent)
+    {
+        uint32_t n = this->m_children.size();
+        bool bChanged = (this->m_weightingMap.size() != n);
+
+        if (bChanged)
+        {
+            this->m_weightingMap.resize(n);
+        }
+
+        for (uint32_t i = 0; i < n; ++i)
         {
-            int w = this->m_weightingMap[i];
+            BehaviorTask* task = this->m_children[i];
+            BEHAVIAC_ASSERT(DecoratorWeightTask::DynamicCast(task));
+            DecoratorWeightTask* pWT = (DecoratorWeightTask*)task;
 
-            sum += w;
+            //a negative weight is never picked, just as 0
+            int weight = pWT->GetWeight(pAgent);
 
-            if (w > 0 && sum >= chosen)   //execute this node
+            if (weight < 0)
             {
-                BehaviorTask* pChild = this->m_children[i];
+                weight = 0;
+            }
 
-                EBTStatus status = pChild->exec(pAgent);
+            if (bChanged || this->m_weightingMap[i] != weight)
+            {
+                this->m_weightingMap[i] = weight;
+                bChanged = true;
+            }
+        }
 
-                if (status == BT_RUNNING)
-                {
-                    this->m_activeChildIndex = i;
+        if (bChanged)
+        {
+            this->BuildAliasTable();
+        }
+    }
 
-                }
-                else
-                {
-                    this->m_activeChildIndex = CompositeTask::InvalidChildIndex;
-                }
+    //Vose's alias method, the worklist keeps the small columns from its front and the large ones from its back
+    void SelectorProbabilityTask::BuildAliasTable()
+    {
+        uint32_t n = this->m_weightingMap.size();
+
+        this->m_totalSum = 0;
+
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            this->m_totalSum += this->m_weightingMap[i];
+        }
 
-                return status;
+        this->m_aliasProbabilities.resize(n);
+        this->m_aliases.resize(n);
+        this->m_aliasWorklist.resize(n);
+
+        if (this->m_totalSum <= 0)
+        {
+            return;
+        }
+
+        uint32_t small = 0;
+        uint32_t large = n;
+
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            double p = (double)this->m_weightingMap[i] * n / this->m_totalSum;
+
+            this->m_aliasProbabilities[i] = p;
+            this->m_aliases[i] = i;
+
+            if (p < 1.0)
+            {
+                this->m_aliasWorklist[small++] = i;
+            }
+            else
+            {
+                this->m_aliasWorklist[--large] = i;
             }
         }
 
-        return BT_FAILURE;
+        while (small > 0 && large < n)
+        {
+            uint32_t s = this->m_aliasWorklist[--small];
+            uint32_t l = this->m_aliasWorklist[large++];
+
+            this->m_aliases[s] = l;
+
+            double p = this->m_aliasProbabilities[l] + this->m_aliasProbabilities[s] - 1.0;
+            this->m_aliasProbabilities[l] = p;
+
+            if (p < 1.0)
+            {
+                this->m_aliasWorklist[small++] = l;
+            }
+            else
+            {
+                this->m_aliasWorklist[--large] = l;
+            }
+        }
+
+        //what is left is 1 but for the rounding errors
+        while (large < n)
+        {
+            this->m_aliasProbabilities[this->m_aliasWorklist[large++]] = 1.0;
+        }
+
+        while (small > 0)
+        {
+            uint32_t s = this->m_aliasWorklist[--small];
+
+            if (this->m_weightingMap[s] > 0)
+            {
+                this->m_aliasProbabilities[s] = 1.0;
+            }
+        }
+    }
+
+    int SelectorProbabilityTask::SelectChild(double random) const
+    {
+        uint32_t n = this->m_aliasProbabilities.size();
+
+        if (n == 0 || this->m_totalSum <= 0)
+        {
+            return -1;
+        }
+
+        double column = random * n;
+        uint32_t i = (uint32_t)column;
+
+        if (i >= n)
+        {
+            i = n - 1;
+        }
+
+        if (column - i < this->m_aliasProbabilities[i])
+        {
+            return (int)i;
+        }
+
+        return (int)this->m_aliases[i];
     }
 }//namespace namespace behaviac
@@ -14,10 +14,11 @@
 #include "behaviac/base/base.h"
 #include "behaviac/behaviortree/nodes/composites/withprecondition.h"
 #include "behaviac/behaviortree/nodes/composites/selectorloop.h"
+#include "behaviac/agent/agent.h"
 
 namespace behaviac
 {
-    WithPrecondition::WithPrecondition()
+    WithPrecondition::WithPrecondition() : m_bPreconditionTracked(false)
     {}
 
     WithPrecondition::~WithPrecondition()
@@ -38,6 +39,18 @@ namespace behaviac
         return super::IsValid(pAgent, pTask);
     }
 
+    void WithPrecondition::AddChild(BehaviorNode* pChild)
+    {
+        super::AddChild(pChild);
+
+        //the first child is the precondition, it is loaded with its children before being added
+        if (this->GetChildrenCount() == 1)
+        {
+            this->m_preconditionReads.clear();
+            this->m_bPreconditionTracked = pChild->GetReadVariables(this->m_preconditionReads);
+        }
+    }
+
     BehaviorTask* WithPrecondition::createTask() const
     {
         WithPreconditionTask* pTask = BEHAVIAC_NEW WithPreconditionTask();
@@ -57,9 +70,28 @@ namespace behaviac
     {
         this->m_bIsUpdatePrecondition = value;
     }
+    EBTStatus WithPreconditionTask::UpdatePrecondition(Agent* pAgent, bool bCaching)
+    {
+        this->m_bIsUpdatePrecondition = true;
+        this->m_bCachingPrecondition = bCaching;
+
+        EBTStatus s = this->exec(pAgent);
+
+        this->m_bIsUpdatePrecondition = false;
+        this->m_bCachingPrecondition = false;
+
+        return s;
+    }
+
     void WithPreconditionTask::copyto(BehaviorTask* target) const
     {
         super::copyto(target);
+
+        BEHAVIAC_ASSERT(WithPreconditionTask::DynamicCast(target));
+        WithPreconditionTask* ttask = (WithPreconditionTask*)target;
+
+        //the result is not valid for the agent of the target
+        ttask->m_cachedAgent = 0;
     }
 
     void WithPreconditionTask::save(ISerializableNode* node) const
@@ -107,12 +139,35 @@ namespace behaviac
 
         if (this->m_bIsUpdatePrecondition)
         {
-
             BehaviorTask* precond = this->m_children[0];
+            const WithPrecondition* pNode = (const WithPrecondition*)this->GetNode();
+            bool bCaching = this->m_bCachingPrecondition && pNode->IsPreconditionTracked();
+
+            if (bCaching && this->m_cachedAgent == pAgent && this->m_cachedNode == precond->GetNode() &&
+                pAgent->m_variables.IsUnchangedSince(this->m_cachedVersion, pNode->GetPreconditionReads()))
+            {
+                this->m_cachedVersion = pAgent->m_variables.GetVersion();
+
+                return this->m_cachedStatus;
+            }
+
+            //a tracked precondition doesn't write any variable, the version is the same after it is executed
+            uint32_t version = pAgent->m_variables.GetVersion();
             EBTStatus s = precond->exec(pAgent, childStatus);
 
-            return s;
+            if (bCaching)
+            {
+                this->m_cachedAgent = pAgent;
+                this->m_cachedNode = precond->GetNode();
+                this->m_cachedVersion = version;
+                this->m_cachedStatus = s;
+            }
+            else
+            {
+                this->m_cachedAgent = 0;
+            }
 
+            return s;
         }
         else
         {
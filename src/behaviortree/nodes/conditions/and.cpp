@@ -53,6 +53,11 @@ namespace behaviac
         return ret;
     }
 
+    bool And::GetReadVariables(behaviac::vector<uint32_t>& variableIds) const
+    {
+        return this->IsPlain() && this->GetChildrenReadVariables(variableIds);
+    }
+
     BehaviorTask* And::createTask() const
     {
         AndTask* pTask = BEHAVIAC_NEW AndTask();
@@ -73,12 +73,18 @@ namespace behaviac
     }
 
     Property* Condition::LoadLeft(const char* value)
+    {
+        behaviac::string typeName;
+
+        return LoadLeft(value, typeName);
+    }
+
+    Property* Condition::LoadLeft(const char* value, behaviac::string& typeName)
     {
         Property* opl = NULL;
 
         if (value[0] != '0')
         {
-            behaviac::string typeName;
             opl = ParseProperty(value, typeName);
         }
 
@@ -192,6 +198,12 @@ namespace behaviac
         }
     }
 
+    bool Condition::GetReadVariables(behaviac::vector<uint32_t>& variableIds) const
+    {
+        //a condition without a comparator is evaluated by its own update_impl
+        return this->m_comparator != NULL && this->IsPlain() && this->m_comparator->GetReadVariables(variableIds);
+    }
+
     BehaviorTask* Condition::createTask() const
     {
         ConditionTask* pTask = BEHAVIAC_NEW ConditionTask();
@@ -252,6 +264,26 @@ namespace behaviac
         return 0;
     }
 
+    VariableComparator* Condition::CreateAssignment(const char* typeName, Property* lhs, Property* rhs, CMethodBase* rhs_m)
+    {
+        //an agent is stored as its own type rather than 'void*'
+        if (Agent::IsAgentClassName(typeName))
+        {
+            return 0;
+        }
+
+        VariableComparatorIterator it = ComparatorCreators().find(typeName);
+
+        if (it != ComparatorCreators().end() && it->second)
+        {
+            VariableComparatorCreator* pCreator = it->second;
+
+            return (*pCreator)(VariableComparisonType_Assignment, lhs, 0, rhs, rhs_m);
+        }
+
+        return 0;
+    }
+
     void ConditionTask::copyto(BehaviorTask* target) const
     {
         super::copyto(target);
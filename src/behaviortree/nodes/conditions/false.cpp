@@ -27,6 +27,13 @@ namespace behaviac
         super::load(version, agentType, properties);
     }
 
+    bool False::GetReadVariables(behaviac::vector<uint32_t>& variableIds) const
+    {
+        BEHAVIAC_UNUSED_VAR(variableIds);
+
+        return this->IsPlain();
+    }
+
     bool False::IsValid(Agent* pAgent, BehaviorTask* pTask) const
     {
         if (!False::DynamicCast(pTask->GetNode()))
@@ -53,6 +53,12 @@ namespace behaviac
 
         return ret;
     }
+
+    bool Or::GetReadVariables(behaviac::vector<uint32_t>& variableIds) const
+    {
+        return this->IsPlain() && this->GetChildrenReadVariables(variableIds);
+    }
+
     BehaviorTask* Or::createTask() const
     {
         OrTask* pTask = BEHAVIAC_NEW OrTask();
@@ -67,7 +67,7 @@ namespace behaviac
         return pTask;
     }
 
-    DecoratorFramesTask::DecoratorFramesTask() : DecoratorTask(), m_start(0), m_frames(0)
+    DecoratorFramesTask::DecoratorFramesTask() : DecoratorTask(), m_start(0), m_frames(0), m_contextId(0)
     {
     }
 
@@ -92,6 +92,7 @@ namespace behaviac
 
         ttask->m_start = this->m_start;
         ttask->m_frames = this->m_frames;
+        ttask->m_contextId = this->m_contextId;
     }
 
     void DecoratorFramesTask::save(ISerializableNode* node) const
@@ -130,6 +131,7 @@ namespace behaviac
         super::onenter(pAgent);
 
         this->m_start = 0;
+        this->m_contextId = pAgent->GetContextId();
         this->m_frames = this->GetFrames(pAgent);
 
         return (this->m_frames > 0);
@@ -139,7 +141,7 @@ namespace behaviac
     {
         BEHAVIAC_UNUSED_VAR(status);
 
-        this->m_start += (int)(Workspace::GetInstance()->GetDeltaFrames());
+        this->m_start += (int)(Context::GetContext(this->m_contextId).GetDeltaFrames());
 
         if (this->m_start >= this->m_frames)
         {
@@ -144,7 +144,6 @@ namespace behaviac
 
         if (this->m_opr_m != NULL)
         {
-            this->m_opr_m->Invoke(pAgent);
             Agent* pParentOpl = this->m_opl->GetParentAgent(pAgent);
             Agent* pParentR = this->m_opr_m->GetParentAgent(pAgent);
 
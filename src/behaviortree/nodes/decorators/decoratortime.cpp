@@ -66,7 +66,7 @@ namespace behaviac
         return pTask;
     }
 
-    DecoratorTimeTask::DecoratorTimeTask() : DecoratorTask(), m_start(0), m_time(0)
+    DecoratorTimeTask::DecoratorTimeTask() : DecoratorTask(), m_start(0), m_time(0), m_contextId(0)
     {
     }
 
@@ -91,6 +91,7 @@ namespace behaviac
 
         ttask->m_start = this->m_start;
         ttask->m_time = this->m_time;
+        ttask->m_contextId = this->m_contextId;
     }
 
     void DecoratorTimeTask::save(ISerializableNode* node) const
@@ -129,6 +130,7 @@ namespace behaviac
         super::onenter(pAgent);
 
         this->m_start = 0;
+        this->m_contextId = pAgent->GetContextId();
         this->m_time = this->GetTime(pAgent);
 
         if (this->m_time <= 0)
@@ -143,7 +145,7 @@ namespace behaviac
     {
         BEHAVIAC_UNUSED_VAR(status);
 
-        this->m_start += (int)(Workspace::GetInstance()->GetDeltaFrameTime() * 1000.0f);
+        this->m_start += (int)(Context::GetContext(this->m_contextId).GetDeltaFrameTime() * 1000.0f);
 
         if (this->m_start >= this->m_time)
         {
@@ -36,6 +36,12 @@ namespace behaviac
 		return super::IsValid(pAgent, pTask);
 	}
 
+	bool FSM::IsSharable() const
+	{
+		//the states are found by the ids of the nodes
+		return false;
+	}
+
 	BehaviorTask* FSM::createTask() const
 	{
 		FSMTask* pTask = BEHAVIAC_NEW FSMTask();
@@ -105,7 +111,7 @@ namespace behaviac
 
 		while (bLoop)
 		{
-			BehaviorTask* currentState = this->GetChildById(this->m_currentNodeId);
+			BehaviorTask* currentState = this->GetStateById(this->m_currentNodeId);
 			currentState->exec(pAgent);
 
 			if (StateTask::DynamicCast(currentState) != 0)
@@ -135,6 +141,21 @@ namespace behaviac
 		return status;
 	}
 
+	BehaviorTask* FSMTask::GetStateById(int id)
+	{
+		BehaviorTreeTask* tree = BehaviorTreeTask::DynamicCast(this->m_parent);
+
+		if (tree != 0)
+		{
+			BehaviorTask* state = (BehaviorTask*)tree->GetTaskById(id);
+			BEHAVIAC_ASSERT(state == 0 || state->GetParent() == this);
+
+			return state;
+		}
+
+		return this->GetChildById(id);
+	}
+
 	EBTStatus FSMTask::update_current(Agent* pAgent, EBTStatus childStatus)
 	{
 		EBTStatus status = this->update(pAgent, childStatus);
@@ -2,6 +2,7 @@
 #include "behaviac/behaviortree/attachments/effector.h"
 #include "behaviac/fsm/startcondition.h"
 #include "behaviac/fsm/transitioncondition.h"
+#include "behaviac/agent/agent.h"
 
 namespace behaviac
 {
@@ -51,6 +52,7 @@ namespace behaviac
             Transition* pTransition = (Transition*)pAttachment;
             BEHAVIAC_ASSERT(pTransition != 0);
             this->m_transitions.push_back(pTransition);
+            this->m_transitionTable.Add(pTransition);
 
     //time2015-07-24 15:49:05
             return;
@@ -70,6 +72,12 @@ namespace behaviac
         return super::IsValid(pAgent, pTask);
     }
 
+    bool State::IsSharable() const
+    {
+        //the transitions target the ids of the other states
+        return false;
+    }
+
 	BehaviorTask* State::createTask() const
 	{
 		StateTask* pTask = BEHAVIAC_NEW StateTask();
@@ -83,7 +91,7 @@ namespace behaviac
 	}
 
 	int SetNodeId(int nodeId);
-	void ClearNodeId(int slot);
+	void RestoreNodeId(int previousId);
 
 	EBTStatus State::update_impl(Agent* pAgent, EBTStatus childStatus)
 	{
@@ -100,13 +108,13 @@ namespace behaviac
 		{
 			int nodeId = this->GetId();
 
-			int slot = SetNodeId(nodeId);
-			BEHAVIAC_ASSERT(slot != -1, "no empty slot found!");
+			int previousId = SetNodeId(nodeId);
 
 			const Agent* pParent = this->m_method->GetParentAgent(pAgent);
-			this->m_method->run(pParent, pAgent);
+			//the return value is not used, so it is not kept
+			this->m_method->run(pParent, pAgent, 0);
 
-			ClearNodeId(slot);
+			RestoreNodeId(previousId);
 		}
 		else
 		{
@@ -118,7 +126,7 @@ namespace behaviac
 
 	//nextStateId holds the next state id if it returns running when a certain transition is satisfied
 	//otherwise, it returns success or failure if it ends
-	EBTStatus State::Update(Agent* pAgent, int& nextStateId)
+	EBTStatus State::Update(Agent* pAgent, int& nextStateId, StateTask* pTask)
 	{
 		nextStateId = -1;
 
@@ -132,13 +140,31 @@ namespace behaviac
 		}
 		else
 		{
-			bool bTransitioned = UpdateTransitions(pAgent, this, (const behaviac::vector<Transition*>*)&this->m_transitions, nextStateId);
+			bool bCaching = pTask != 0 && pTask->IsCachingTransitions(pAgent);
+
+			if (bCaching && pTask->m_cachedAgent == pAgent &&
+				pAgent->m_variables.IsUnchangedSince(pTask->m_cachedVersion, this->m_transitionTable.GetReadVariables()))
+			{
+				//none of the transitions is satisfied since they were evaluated last time
+				pTask->m_cachedVersion = pAgent->m_variables.GetVersion();
+
+				return result;
+			}
+
+			uint32_t version = pAgent->m_variables.GetVersion();
+			bool bTransitioned = UpdateTransitions(pAgent, this, &this->m_transitionTable, nextStateId);
 
 			if (bTransitioned)
 			{
 				//it will transition to another state, set result as success so as it exits
 				result = BT_SUCCESS;
 			}
+
+			if (pTask != 0)
+			{
+				pTask->m_cachedAgent = (bCaching && !bTransitioned) ? pAgent : 0;
+				pTask->m_cachedVersion = version;
+			}
 		}
 
 		return result;
@@ -146,42 +172,34 @@ namespace behaviac
 
 	void CHECK_BREAKPOINT(Agent* pAgent, const BehaviorNode* b, const char* action, EActionResult actionResult);
 
-	bool State::UpdateTransitions(Agent* pAgent, const BehaviorNode* node, const behaviac::vector<Transition*>* transitions, int& nextStateId)
+	bool State::UpdateTransitions(Agent* pAgent, const BehaviorNode* node, const TransitionTable* transitions, int& nextStateId)
 	{
 		BEHAVIAC_UNUSED_VAR(node);
 		bool bTransitioned = false;
 
-		if (transitions && transitions->size() > 0)
-		{
-			for (uint32_t i = 0; i < transitions->size(); ++i)
-			{
-				Transition* transition = (*transitions)[i];
+		Transition* transition = transitions ? transitions->Evaluate(pAgent) : 0;
 
-				if (transition->Evaluate(pAgent))
-				{
-					nextStateId = transition->GetTargetStateId();
-					BEHAVIAC_ASSERT(nextStateId != -1);
+		if (transition)
+		{
+			nextStateId = transition->GetTargetStateId();
+			BEHAVIAC_ASSERT(nextStateId != -1);
 
-					//transition actions
-					transition->ApplyEffects(pAgent, Effector::E_BOTH);
+			//transition actions
+			transition->ApplyEffects(pAgent, Effector::E_BOTH);
 
 #if !BEHAVIAC_RELEASE
-					if (Config::IsLoggingOrSocketing())
-					{
-						CHECK_BREAKPOINT(pAgent, node, "transition", EAR_none);
-					}
-#endif
-					bTransitioned = true;
-
-					break;
-				}
+			if (Config::IsLoggingOrSocketing())
+			{
+				CHECK_BREAKPOINT(pAgent, node, "transition", EAR_none);
 			}
+#endif
+			bTransitioned = true;
 		}
 
 		return bTransitioned;
 	}
 
-	StateTask::StateTask() : m_nextStateId(-1)
+	StateTask::StateTask() : m_nextStateId(-1), m_cachedAgent(0), m_cachedVersion(0)
 	{
 	}
 
@@ -192,6 +210,12 @@ namespace behaviac
 	void StateTask::copyto(BehaviorTask* target) const
 	{
 		super::copyto(target);
+
+		BEHAVIAC_ASSERT(StateTask::DynamicCast(target));
+		StateTask* ttask = (StateTask*)target;
+
+		//the version belongs to the variables of the agent it was cached for
+		ttask->m_cachedAgent = 0;
 	}
 
 	void StateTask::save(ISerializableNode* node) const
@@ -222,6 +246,7 @@ namespace behaviac
 	{
 		BEHAVIAC_UNUSED_VAR(pAgent);
 		this->m_nextStateId = -1;
+		this->m_cachedAgent = 0;
 		return true;
 	}
 
@@ -239,11 +264,34 @@ namespace behaviac
 
 		State* pStateNode = (State*)(this->GetNode());
 
-		EBTStatus result = pStateNode->Update(pAgent, this->m_nextStateId);
+		EBTStatus result = pStateNode->Update(pAgent, this->m_nextStateId, this);
 
 		return result;
 	}
 
+	bool StateTask::IsCachingTransitions(Agent* pAgent) const
+	{
+		const State* pStateNode = (const State*)(this->GetNode());
+
+		//the planner reads and writes the variables in its own states, they are not tracked
+		if (!pStateNode->GetTransitionTable().IsTracked() || pAgent->m_variables.Top() != -1)
+		{
+			return false;
+		}
+
+		for (const BehaviorTask* task = this->GetParent(); task != 0; task = task->GetParent())
+		{
+			if (BehaviorTreeTask::DynamicCast(task) != 0)
+			{
+				const BehaviorTree* tree = (const BehaviorTree*)task->GetNode();
+
+				return tree->IsTransitionCaching();
+			}
+		}
+
+		return false;
+	}
+
 }
 
 
@@ -11,6 +11,8 @@
 // See the License for the specific language governing permissions and limitations under the License.
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #include "behaviac/fsm/transitioncondition.h"
+#include "behaviac/property/comparator.h"
+
 namespace behaviac
 {
     bool Transition::IsValid(Agent* pAgent, BehaviorTask* pTask) const
@@ -22,4 +24,54 @@ namespace behaviac
 
         return super::IsValid(pAgent, pTask);
     }
+
+    TransitionTable::TransitionTable() : m_bTracked(true), m_bUnconditional(false)
+    {
+    }
+
+    void TransitionTable::Add(Transition* pTransition)
+    {
+        BEHAVIAC_ASSERT(pTransition);
+
+        if (this->m_bUnconditional)
+        {
+            return;
+        }
+
+        Entry entry;
+        entry.transition = pTransition;
+        entry.comparator = pTransition->GetComparator();
+
+        if (pTransition->IsUnconditional())
+        {
+            entry.comparator = 0;
+            this->m_bUnconditional = true;
+            this->m_bTracked = false;
+        }
+        else if (entry.comparator == 0 || !entry.comparator->GetReadVariables(this->m_readVariables))
+        {
+            this->m_bTracked = false;
+        }
+
+        this->m_entries.push_back(entry);
+    }
+
+    Transition* TransitionTable::Evaluate(Agent* pAgent) const
+    {
+        for (uint32_t i = 0; i < this->m_entries.size(); ++i)
+        {
+            const Entry& entry = this->m_entries[i];
+
+            //a comparison which is not satisfied falls back to update_impl in AttachAction::Evaluate,
+            //which fails for a transition loaded from xml or bson
+            bool bValid = entry.comparator ? entry.comparator->Execute(pAgent) : entry.transition->Evaluate(pAgent);
+
+            if (bValid)
+            {
+                return entry.transition;
+            }
+        }
+
+        return 0;
+    }
 }
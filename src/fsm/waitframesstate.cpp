@@ -66,10 +66,8 @@ namespace behaviac
 			BEHAVIAC_ASSERT(pParent);
 			/*}*/
 
-			this->m_frames_method->run(pParent, pAgent);
-
 			int frames = 0;
-			this->m_frames_method->GetReturnValue(pParent, frames);
+			this->m_frames_method->Invoke(pParent, pAgent, frames);
 
 			return frames;
 		}
@@ -181,7 +179,7 @@ namespace behaviac
 		BEHAVIAC_ASSERT(WaitFramesState::DynamicCast(this->GetNode()) != 0, "node is not an WaitFramesState");
 		WaitFramesState* pStateNode = (WaitFramesState*)(this->GetNode());
 
-		this->m_start += (int)(Workspace::GetInstance()->GetDeltaFrames());
+		this->m_start += (int)(Context::GetContext(pAgent->GetContextId()).GetDeltaFrames());
 
 		if (this->m_start >= this->m_frames)
 		{
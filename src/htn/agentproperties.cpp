@@ -99,6 +99,7 @@ namespace behaviac
     }
 
     map<behaviac::string, AgentProperties*> AgentProperties::agent_type_blackboards;
+    behaviac::Mutex AgentProperties::ms_localsCs;
 
     AgentProperties::AgentProperties(const char* agentType)
     {
@@ -130,6 +131,16 @@ namespace behaviac
 
     Property* AgentProperties::AddLocal(const char* agentType, const char* typeName, const char* variableName, const char* valueStr)
     {
+        //the trees built by the workers of HotReloadAsync add their locals when they are swapped in
+        Property* pDeferred = Workspace::GetInstance()->DeferLocal(agentType, typeName, variableName, valueStr);
+
+        if (pDeferred)
+        {
+            return pDeferred;
+        }
+
+        behaviac::ScopedLock lock(ms_localsCs);
+
         AgentProperties* bb = AgentProperties::Get(agentType);
 
         //if agent type has no property and custom property
@@ -143,6 +154,30 @@ namespace behaviac
         return pProperty;
     }
 
+    void AgentProperties::AddLocal(const char* agentType, Property* pLocal)
+    {
+        behaviac::ScopedLock lock(ms_localsCs);
+
+        AgentProperties* bb = AgentProperties::Get(agentType);
+
+        if (bb == NULL)
+        {
+            bb = BEHAVIAC_NEW AgentProperties(agentType);
+            agent_type_blackboards[agentType] = bb;
+        }
+
+        uint32_t variableId = MakeVariableId(pLocal->Name());
+
+        //the same local might be added by several nodes, or by another tree in the meantime
+        if (bb->GetProperty(variableId) != NULL)
+        {
+            BEHAVIAC_DELETE pLocal;
+            return;
+        }
+
+        bb->m_locals[variableId] = pLocal;
+    }
+
     Property* AgentProperties::GetProperty(const char* agentType, const char* variableName)
     {
         AgentProperties* bb = AgentProperties::Get(agentType);
@@ -179,9 +214,12 @@ namespace behaviac
 
     AgentProperties* AgentProperties::Get(const char* agentType)
     {
-        if (agent_type_blackboards[agentType] != NULL)
+        //not to insert the unknown types, it is read by the workers of HotReloadAsync
+        map<behaviac::string, AgentProperties*>::iterator it = agent_type_blackboards.find(agentType);
+
+        if (it != agent_type_blackboards.end())
         {
-            return agent_type_blackboards[agentType];
+            return it->second;
         }
 
         return NULL;
@@ -189,6 +227,8 @@ namespace behaviac
 
     void AgentProperties::UnloadLoacals()
     {
+        behaviac::ScopedLock lock(ms_localsCs);
+
         for (map<behaviac::string, AgentProperties*>::iterator it = agent_type_blackboards.begin(); it != agent_type_blackboards.end(); it++)
         {
             AgentProperties* bb = it->second;
@@ -64,6 +64,13 @@ namespace behaviac
 
         return super::IsValid(pAgent, pTask);
     }
+
+    bool Method::IsSharable() const
+    {
+        //the htn trees are not shared, see Task::IsSharable
+        return false;
+    }
+
     BehaviorTask* Method::createTask() const
     {
         BEHAVIAC_ASSERT(false);
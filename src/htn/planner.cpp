@@ -254,7 +254,7 @@ namespace behaviac
             return;
         }
 
-        this->timeTillReplan -= Workspace::GetInstance()->GetDeltaFrameTime();
+        this->timeTillReplan -= Context::GetContext(this->agent->GetContextId()).GetDeltaFrameTime();
 
         bool noPlan = this->m_rootTask == NULL || this->m_rootTask->GetStatus() != BT_RUNNING;
 
@@ -295,7 +295,7 @@ namespace behaviac
             behaviac::string agentInstanceName(a->GetName());
 
             behaviac::string ni = BehaviorTask::GetTickInfo(a, root, "plan");
-            int count = Workspace::GetInstance()->GetActionCount(ni.c_str()) + 1;
+            int count = Workspace::GetInstance()->GetActionCount(a, ni.c_str()) + 1;
             behaviac::string buffer = FormatString("[plan_begin]%s#%s %s %d\n", agentClassName.c_str(), agentInstanceName.c_str(), ni.c_str(), count);
 
             LogManager::GetInstance()->Log(buffer.c_str());
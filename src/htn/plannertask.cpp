@@ -418,6 +418,15 @@ namespace behaviac
 #endif
     }
 
+    PlannerTaskReference::~PlannerTaskReference()
+    {
+        if (this->m_subTree)
+        {
+            Workspace::GetInstance()->DestroyBehaviorTreeTask(this->m_subTree, 0);
+            this->m_subTree = 0;
+        }
+    }
+
     bool PlannerTaskReference::CheckPreconditions(Agent* pAgent, bool bIsAlive)
     {
         this->currentState = pAgent->m_variables.Push(false);
@@ -463,7 +472,11 @@ namespace behaviac
 
         BEHAVIAC_ASSERT(pNode != NULL);
 
-		this->m_subTree = 0;
+		if (this->m_subTree)
+		{
+			Workspace::GetInstance()->DestroyBehaviorTreeTask(this->m_subTree, 0);
+			this->m_subTree = 0;
+		}
 
 #if !BEHAVIAC_RELEASE
         pAgent->LogReturnTree(pNode->GetReferencedTree());
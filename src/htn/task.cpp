@@ -81,6 +81,13 @@ namespace behaviac
 
         return super::IsValid(pAgent, pTask);
     }
+
+    bool Task::IsSharable() const
+    {
+        //the planner instantiates the pars of the tree holding it, see PlannerTaskTask
+        return false;
+    }
+
     BehaviorTask* Task::createTask() const
     {
         TaskTask* pTask = BEHAVIAC_NEW TaskTask();
@@ -148,6 +155,14 @@ namespace behaviac
     {
         super::load(node);
     }
+
+    bool TaskTask::rebind(const BehaviorNode* node)
+    {
+        BEHAVIAC_UNUSED_VAR(node);
+
+        //the planner keeps the nodes it decomposed, it is recreated instead
+        return false;
+    }
     bool TaskTask::onenter(Agent* pAgent)
     {
         this->m_activeChildIndex = CompositeTask::InvalidChildIndex;
@@ -18,7 +18,7 @@
 
 namespace behaviac
 {
-    Variables::Variables()
+    Variables::Variables() : m_version(0)
     {
         BEHAVIAC_ASSERT(this->m_variables.size() == 0);
     }
@@ -41,6 +41,33 @@ namespace behaviac
         this->m_variables.clear();
     }
 
+    bool Variables::IsUnchangedSince(uint32_t version, const behaviac::vector<uint32_t>& variableIds) const
+    {
+        if (version == this->m_version)
+        {
+            return true;
+        }
+
+        for (behaviac::vector<uint32_t>::const_iterator it = variableIds.begin(); it != variableIds.end(); ++it)
+        {
+            Variables_t::const_iterator itVar = this->m_variables.find(*it);
+
+            if (itVar == this->m_variables.end())
+            {
+                return false;
+            }
+
+            const IVariable* pVar = itVar->second;
+
+            if (pVar->m_pMember || pVar->m_instantiated == 0 || pVar->m_version > version)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     void Variables::Log(const Agent* pAgent, bool bForce)
     {
         BEHAVIAC_UNUSED_VAR(pAgent);
@@ -118,6 +145,8 @@ namespace behaviac
             const IVariable* pVar = it->second;
             IVariable* pNew = pVar->clone();
 
+            //the version of the source is not meaningful in the target
+            pNew->m_version = ++target.m_version;
             target.m_variables[pNew->GetId()] = pNew;
         }
 
@@ -199,6 +228,7 @@ namespace behaviac
 				Property* p = Property::Create(typeStr.c_str(), nameStr.c_str(), valueStr.c_str());
 
                 IVariable* pVar = p->CreateVar();
+                pVar->m_version = ++this->m_version;
 
                 uint32_t varId = MakeVariableId(nameStr.c_str());
                 this->m_variables[varId] = pVar;
@@ -383,6 +383,9 @@ namespace behaviac
             //BEHAVIAC_ASSERT(false, "accessing a not declared local variable");
             const char* valueStr = 0;
             pProperty = AgentProperties::AddLocal(agentType, typeName, variableName, valueStr);
+
+            //clone it as the registered local is kept after the node owning the returned one is deleted
+            pProperty = pProperty->clone();
         }
 
         return pProperty;
@@ -50,6 +50,8 @@ public:
 
     behaviac::EBTStatus Wander();
     behaviac::EBTStatus Fidget();
+
+    behaviac::EBTStatus IsAlive();
 };
 
 CPerformanceAgent::CPerformanceAgent()
@@ -184,6 +186,11 @@ behaviac::EBTStatus CPerformanceAgent::Fidget()
     TEST_LOGINFO("Fidget HP=%f DistanceToEnemy=%f Hungry=%f Food=%f\n", HP, DistanceToEnemy, Hungry, Food);
     return behaviac::BT_SUCCESS;
 }
+
+behaviac::EBTStatus CPerformanceAgent::IsAlive()
+{
+    return HP > 0.0f ? behaviac::BT_SUCCESS : behaviac::BT_FAILURE;
+}
 #pragma  optimize("", on)
 
 BEGIN_PROPERTIES_DESCRIPTION(CPerformanceAgent)
@@ -199,6 +206,7 @@ BEGIN_PROPERTIES_DESCRIPTION(CPerformanceAgent)
 	REGISTER_METHOD(Eat);
 	REGISTER_METHOD(Wander);
 	REGISTER_METHOD(Fidget);
+	REGISTER_METHOD(IsAlive);
 }
 END_PROPERTIES_DESCRIPTION()
 
@@ -244,6 +252,7 @@ void RegisterTypes();
 void UnRegisterTypes();
 
 void btagenttick(behaviac::Workspace::EFileFormat format, int countAgents);
+void btmethodcall(int count);
 
 static void SetExePath()
 {
@@ -307,7 +316,12 @@ int main(int argc, char** argv)
 
     //behaviac::Socket::SetupConnection(false);
 
-    btagenttick(format, countAgents);
+    if (CLPP.ParameterExist("-methodcall")) {
+        btmethodcall(CLPP.ParameterEqualExist("-calls=") * 1000000);
+
+    } else {
+        btagenttick(format, countAgents);
+    }
 
     //behaviac::Socket::ShutdownConnection();
 
@@ -435,5 +449,95 @@ void btagenttick(behaviac::Workspace::EFileFormat format, int countAgents)
 
     
 
+    printf("\ndone\n");
+}
+
+class IStatusCall
+{
+public:
+    virtual ~IStatusCall() {
+    }
+
+    virtual behaviac::EBTStatus Call(CPerformanceAgent* pA) = 0;
+};
+
+class IsAliveCall : public IStatusCall
+{
+public:
+    virtual behaviac::EBTStatus Call(CPerformanceAgent* pA) {
+        return pA->IsAlive();
+    }
+};
+
+//the overhead of calling an action method 'count' times through the IAsyncValue path, the typed thunk
+//and a plain virtual call which is the baseline
+void btmethodcall(int count)
+{
+    printf("\nMethod calls %d\n", count);
+
+    behaviac::Agent::Register<CPerformanceAgent>();
+
+    CPerformanceAgent* pA = behaviac::Agent::Create<CPerformanceAgent>();
+    CMethodBase* pMethod = behaviac::Agent::CreateMethod(CStringID("CPerformanceAgent"), CStringID("IsAlive"));
+    BEHAVIAC_ASSERT(pMethod && pMethod->IsReturnType<behaviac::EBTStatus>());
+
+    IStatusCall* pCall = BEHAVIAC_NEW IsAliveCall();
+    behaviac::IAsyncValue* pReturn = pMethod->CreateReturnValue();
+    int succeeded = 0;
+
+    behaviac::Config::SetProfiling(true);
+    behaviac::Profiler::GetInstance()->SetOutputDebugBlock(true);
+    behaviac::Profiler::GetInstance()->SetHierarchy(false);
+
+    behaviac::Profiler::GetInstance()->BeginFrame();
+
+    {
+        BEHAVIAC_PROFILE("IAsyncValue");
+
+        for (int i = 0; i < count; ++i) {
+            behaviac::EBTStatus result = behaviac::BT_INVALID;
+            pMethod->run(pA, pA, pReturn);
+            pMethod->CheckReturn(pA, pReturn, result);
+            succeeded += (result == behaviac::BT_SUCCESS) ? 1 : 0;
+        }
+    }
+
+    {
+        BEHAVIAC_PROFILE("TypedThunk");
+
+        for (int i = 0; i < count; ++i) {
+            behaviac::EBTStatus result = behaviac::BT_INVALID;
+            pMethod->Call(pA, pA, &result);
+            succeeded += (result == behaviac::BT_SUCCESS) ? 1 : 0;
+        }
+    }
+
+    {
+        BEHAVIAC_PROFILE("VirtualCall");
+
+        for (int i = 0; i < count; ++i) {
+            succeeded += (pCall->Call(pA) == behaviac::BT_SUCCESS) ? 1 : 0;
+        }
+    }
+
+    behaviac::Profiler::GetInstance()->EndFrame();
+
+    BEHAVIAC_ASSERT(succeeded == 3 * count);
+
+    const behaviac::string profile_data = behaviac::Profiler::GetInstance()->GetData(true, false);
+
+    behaviac::string profile_data_m = "\n";
+    profile_data_m += profile_data;
+    profile_data_m += "\n";
+
+    behaviac::ConsoleOut::PrintLines(profile_data_m.c_str());
+
+    BEHAVIAC_DELETE(pReturn);
+    BEHAVIAC_DELETE(pCall);
+    BEHAVIAC_DELETE(pMethod);
+    behaviac::Agent::Destroy(pA);
+
+    behaviac::Agent::UnRegister<CPerformanceAgent>();
+
     printf("\ndone\n");
 }
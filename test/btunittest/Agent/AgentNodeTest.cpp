@@ -71,6 +71,7 @@ BEGIN_PROPERTIES_DESCRIPTION(AgentNodeTest)
     REGISTER_METHOD(setTestVar_2);
     REGISTER_METHOD(setTestVar_0_2);
     REGISTER_METHOD(setTestVar_R);
+    REGISTER_METHOD(getTestVar_2);
     REGISTER_METHOD(setTestVar_3);
     REGISTER_METHOD(enter_action_0);
     REGISTER_METHOD(exit_action_0);
@@ -132,6 +132,11 @@ public:
         return (float)testVar_0 + testVar_2;
     }
 
+    double getTestVar_2()
+    {
+        return testVar_2;
+    }
+
     void setTestVar_3(float var)
     {
         testVar_3 = var;
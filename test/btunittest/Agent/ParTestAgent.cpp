@@ -70,6 +70,7 @@ BEGIN_PROPERTIES_DESCRIPTION(ParTestAgent)
 
     REGISTER_METHOD(Func_ShortRef).DISPLAYNAME(L"1 # UPR_Short").DESC(L"A");
     REGISTER_METHOD(Func_IntRef).DISPLAYNAME(L"1 # UPR_Int").DESC(L"A");
+    REGISTER_METHOD(Func_IntRefInc).DISPLAYNAME(L"1 # UPR_IntInc").DESC(L"A");
     REGISTER_METHOD(Func_LongRef).DISPLAYNAME(L"1 # UPR_Long").DESC(L"A");
     REGISTER_METHOD(Func_UShortRef).DISPLAYNAME(L"1 # UPR_UShort").DESC(L"A");
     REGISTER_METHOD(Func_kEmployeeRef).DISPLAYNAME(L"1 # UPR_kEmployee").DESC(L"A");
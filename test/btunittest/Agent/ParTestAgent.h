@@ -70,6 +70,13 @@ public:
         par = 2;
     }
 
+    //[behaviac.MethodMetaInfo("1 # UPR_IntInc", "A")]
+    int Func_IntRefInc(signed int& par)
+    {
+        par += 1;
+        return par;
+    }
+
     //[behaviac.MethodMetaInfo("1 # UPR_Long", "A")]
     void Func_LongRef(long& par)
     {
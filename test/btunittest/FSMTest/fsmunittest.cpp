@@ -15,6 +15,7 @@ add 2015 08 21
 */
 #include "../btloadtestsuite.h"
 #include "behaviac/base/core/profiler/profiler.h"
+#include "behaviac/fsm/state.h"
 FSMAgentTest* initTestEnvFSM(const char* treePath, behaviac::Workspace::EFileFormat format)
 {
     behaviac::Profiler::CreateInstance();
@@ -267,3 +268,139 @@ LOAD_TEST(btunittest, bt_ref_fsm)
 
     finlTestEnvFSM(testAgent);
 }
+
+LOAD_TEST(btunittest, bt_ref_fsm_reenter)
+{
+    const char* kSubTree = "node_test/fsm/fsm_ut_0";
+
+    FSMAgentTest* testAgent = initTestEnvFSM("node_test/fsm/bt_ref_fsm", format);
+    behaviac::Workspace::GetInstance()->SetBehaviorTreeTaskPool(kSubTree, 0, 4);
+    testAgent->resetProperties();
+
+    behaviac::Workspace::BehaviorTreeTaskPoolStats_t stats;
+
+    //run the referenced fsm into its Active state
+    testAgent->Message = FSMAgentTest::Begin;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        testAgent->btexec();
+    }
+
+    CHECK_EQUAL(8, testAgent->GetVariable<int>("FoodCount"));
+    CHECK_EQUAL(1, testAgent->GetVariable<int>("EnergyCount"));
+
+    behaviac::Workspace::GetInstance()->GetBehaviorTreeTaskPoolStats(kSubTree, stats);
+    CHECK_EQUAL(1, stats.misses);
+
+    //entered again, the reused subtree task starts from the initial state instead of the Active one
+    testAgent->btresetcurrrent();
+    behaviac::EBTStatus status = testAgent->btexec();
+    CHECK_EQUAL(behaviac::BT_RUNNING, status);
+
+    CHECK_EQUAL(1, testAgent->GetVariable<int>("FoodCount"));
+    CHECK_EQUAL(1, testAgent->GetVariable<int>("EnergyCount"));
+
+    behaviac::Workspace::GetInstance()->GetBehaviorTreeTaskPoolStats(kSubTree, stats);
+    CHECK_EQUAL(0, stats.hits);
+    CHECK_EQUAL(1, stats.misses);
+    CHECK_EQUAL(0, stats.pooled);
+
+    //the subtree task is released to the pool together with the referencing task
+    BEHAVIAC_DELETE(testAgent);
+
+    behaviac::Workspace::GetInstance()->GetBehaviorTreeTaskPoolStats(kSubTree, stats);
+    CHECK_EQUAL(1, stats.pooled);
+
+    behaviac::Workspace::GetInstance()->SetBehaviorTreeTaskPool(kSubTree, 0, 0);
+
+    unregisterAllTypes();
+
+    behaviac::Profiler::DestroyInstance();
+}
+
+//sets InactiveCount and ActiveCount compared by the transitions of node_test/fsm/fsm_ut_2
+static void set_fsm_ut_2_inputs(FSMAgentTest* pAgent, uint32_t seed)
+{
+    //some ticks keep the inputs of the last one, so that the transitions are not satisfied for a while
+    if (seed % 4 == 0)
+    {
+        pAgent->SetVariable("InactiveCount", (int)(seed >> 8) % 3 == 0 ? 1 : 0);
+        pAgent->SetVariable("ActiveCount", (uint32_t)(seed >> 12) % 4);
+    }
+}
+
+LOAD_TEST(btunittest, fsm_transition_caching)
+{
+    //fsm_ut_2 is only exported as xml
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    FSMAgentTest* testAgent = initTestEnvFSM("node_test/fsm/fsm_ut_2", format);
+    behaviac::BehaviorTree* pTree = behaviac::Workspace::GetInstance()->LoadBehaviorTree("node_test/fsm/fsm_ut_2");
+    CHECK_EQUAL(true, pTree != 0);
+
+    const behaviac::BehaviorNode* pFSM = pTree->GetChild(0);
+    const behaviac::State* pInactive = behaviac::State::DynamicCast(pFSM->GetChild(0));
+    const behaviac::State* pPause = behaviac::State::DynamicCast(pFSM->GetChild(2));
+    CHECK_EQUAL(true, pInactive->GetTransitionTable().IsTracked());
+    CHECK_EQUAL(2, (int)pInactive->GetTransitionTable().GetReadVariables().size());
+
+    //the transition after the unconditional one is dropped
+    CHECK_EQUAL(false, pPause->GetTransitionTable().IsTracked());
+    CHECK_EQUAL(1, (int)pPause->GetTransitionTable().GetCount());
+
+    //the other agent runs the same fsm in lock step with the transitions cached, the states must be the same
+    FSMAgentTest* cachingAgent = behaviac::Agent::Create<FSMAgentTest>();
+    cachingAgent->btsetcurrent("node_test/fsm/fsm_ut_2");
+    testAgent->resetProperties();
+    cachingAgent->resetProperties();
+
+    uint32_t seed = 12345;
+    int states[5] = { 0 };
+
+    for (int i = 0; i < 300; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        set_fsm_ut_2_inputs(testAgent, seed);
+        set_fsm_ut_2_inputs(cachingAgent, seed);
+
+        pTree->SetTransitionCaching(false);
+        behaviac::EBTStatus status = testAgent->btexec();
+
+        pTree->SetTransitionCaching(true);
+        behaviac::EBTStatus cachedStatus = cachingAgent->btexec();
+
+        short state = testAgent->GetVariable<short>("PauseCount");
+        CHECK_EQUAL(status, cachedStatus);
+        CHECK_EQUAL(state, cachingAgent->GetVariable<short>("PauseCount"));
+        CHECK_EQUAL(testAgent->TestVar, cachingAgent->TestVar);
+        states[state]++;
+    }
+
+    //the inactive, active and end states are all reached
+    CHECK_EQUAL(true, states[1] > 0 && states[2] > 0 && states[3] > 0);
+
+    //a property written behind the runtime's back is not seen by the cached transitions
+    cachingAgent->SetVariable("InactiveCount", 0);
+    cachingAgent->SetVariable("ActiveCount", (uint32_t)0);
+    cachingAgent->btexec();
+    cachingAgent->btexec();
+    CHECK_EQUAL(3, cachingAgent->GetVariable<short>("PauseCount"));
+
+    int& inactiveCount = (int&)cachingAgent->GetVariable<int>("InactiveCount");
+    inactiveCount = 5;
+    cachingAgent->btexec();
+    CHECK_EQUAL(3, cachingAgent->GetVariable<short>("PauseCount"));
+
+    cachingAgent->SetVariable("InactiveCount", 6);
+    cachingAgent->btexec();
+    CHECK_EQUAL(1, cachingAgent->GetVariable<short>("PauseCount"));
+
+    pTree->SetTransitionCaching(false);
+
+    behaviac::Agent::Destroy(cachingAgent);
+    finlTestEnvFSM(testAgent);
+}
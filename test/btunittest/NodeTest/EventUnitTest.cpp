@@ -66,3 +66,33 @@
 //	CHECK_EQUAL(-1.0f, myTestAgent->event_test_var_float);
 //	finlTestEnvNode(myTestAgent);
 //}
+
+LOAD_TEST(btunittest, event_listeners)
+{
+    AgentNodeTest* myTestAgent = initTestEnvNode("node_test/event_ut_0", format);
+    myTestAgent->resetProperties();
+
+    CStringID eventId("event_test_void");
+    CHECK_EQUAL(false, myTestAgent->HasEventListeners(eventId));
+
+    behaviac::EBTStatus status = myTestAgent->btexec();
+    CHECK_EQUAL(behaviac::BT_RUNNING, status);
+    CHECK_EQUAL(true, myTestAgent->HasEventListeners(eventId));
+
+    //the running sequence switches to event_subtree_0, which sets event_test_var_bool, and then returns
+    myTestAgent->FireEvent("event_test_void");
+    CHECK_EQUAL(true, myTestAgent->event_test_var_bool);
+    CHECK_EQUAL(true, myTestAgent->HasEventListeners(eventId));
+
+    //the sequence is exited, its events are not handled any more
+    myTestAgent->testVar_0 = 0;
+    status = myTestAgent->btexec();
+    CHECK_EQUAL(behaviac::BT_SUCCESS, status);
+    CHECK_EQUAL(false, myTestAgent->HasEventListeners(eventId));
+
+    myTestAgent->event_test_var_bool = false;
+    myTestAgent->FireEvent("event_test_void");
+    CHECK_EQUAL(false, myTestAgent->event_test_var_bool);
+
+    finlTestEnvNode(myTestAgent);
+}
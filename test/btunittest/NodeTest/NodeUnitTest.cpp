@@ -344,6 +344,12 @@ void test_stochastic_distribution_2(behaviac::string tree, behaviac::Workspace::
         int k = counts[i];
         int bias = abs(k - refs[i]);
         CHECK_LESS(bias, 1000);
+
+        //a child of weight 0 is never picked
+        if (refs[i] == 0)
+        {
+            CHECK_EQUAL(0, k);
+        }
     }
 
     unregisterAllTypes();
@@ -11,6 +11,9 @@
 // See the License for the specific language governing permissions and limitations under the License.
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #include "behaviac/behaviac.h"
+#include "behaviac/base/core/thread/thread.h"
+#include "behaviac/base/core/thread/wrapper.h"
+#include "behaviac/base/file/file.h"
 
 #include "../btloadtestsuite.h"
 #include "../behaviac_generated/types/customizedtypes.h"
@@ -281,6 +284,364 @@ TEST(btunittest, context)
     behaviac::Profiler::DestroyInstance();
 }
 
+namespace
+{
+    const int kPostingThreads = 4;
+    const int kPostedEvents = 2000;
+
+    //records the posting thread and the sequence number instead of firing the event
+    class RecordedEvent_t : public behaviac::DeferredEvent
+    {
+    public:
+        RecordedEvent_t(const behaviac::Agent* pAgent, int thread, int seq, behaviac::vector<int>* records) :
+            behaviac::DeferredEvent(pAgent, "event_test_void"), m_thread(thread), m_seq(seq), m_records(records)
+        {}
+
+        virtual void Fire(behaviac::Agent* pAgent) const
+        {
+            BEHAVIAC_UNUSED_VAR(pAgent);
+            m_records[m_thread].push_back(m_seq);
+        }
+
+    private:
+        int m_thread;
+        int m_seq;
+        behaviac::vector<int>* m_records;
+    };
+
+    struct PostingContext_t
+    {
+        behaviac::Agent* agent;
+        int contextId;
+        int thread;
+        behaviac::vector<int>* records;
+        volatile behaviac::Atomic32* finished;
+    };
+
+    unsigned int __STDCALL PostingThreadFunction(void* arg)
+    {
+        PostingContext_t* ctx = (PostingContext_t*)arg;
+
+        for (int i = 0; i < kPostedEvents; ++i)
+        {
+            behaviac::Context::PostEvent(ctx->contextId, BEHAVIAC_NEW RecordedEvent_t(ctx->agent, ctx->thread, i, ctx->records));
+        }
+
+        behaviac::AtomicInc(*ctx->finished);
+
+        return 0;
+    }
+}
+
+TEST(btunittest, posted_events)
+{
+    behaviac::Profiler::CreateInstance();
+    behaviac::Config::SetSocketing(false);
+    behaviac::Config::SetLogging(false);
+
+    registerAllTypes();
+
+    const int contextId = 1;
+    ParTestAgent* testAgent = behaviac::Agent::Create<ParTestAgent>(0, contextId);
+
+    behaviac::vector<int> records[kPostingThreads];
+    volatile behaviac::Atomic32 finished = 0;
+    PostingContext_t contexts[kPostingThreads];
+    behaviac::thread::ThreadHandle threads[kPostingThreads];
+
+    for (int i = 0; i < kPostingThreads; ++i)
+    {
+        PostingContext_t& ctx = contexts[i];
+        ctx.agent = testAgent;
+        ctx.contextId = contextId;
+        ctx.thread = i;
+        ctx.records = records;
+        ctx.finished = &finished;
+
+        threads[i] = behaviac::thread::CreateAndStartThread(&PostingThreadFunction, &ctx, 0);
+        CHECK_EQUAL(true, threads[i] != 0);
+    }
+
+    //fire the events and create other contexts while the threads are still posting
+    int createdContexts = 0;
+
+    while (finished < kPostingThreads)
+    {
+        behaviac::Context::execEvents(contextId);
+
+        if (createdContexts < 16)
+        {
+            behaviac::Context::GetContext(contextId + 1 + createdContexts);
+            createdContexts++;
+        }
+    }
+
+    for (int i = 0; i < kPostingThreads; ++i)
+    {
+        behaviac::thread::StopThread(threads[i]);
+    }
+
+    behaviac::Context::execEvents(contextId);
+
+    for (int i = 0; i < kPostingThreads; ++i)
+    {
+        const behaviac::vector<int>& seqs = records[i];
+        CHECK_EQUAL(kPostedEvents, (int)seqs.size());
+
+        for (int j = 0; j < (int)seqs.size(); ++j)
+        {
+            CHECK_EQUAL(j, seqs[j]);
+        }
+    }
+
+    //an event posted to a context which doesn't exist is dropped, it is not an error of the posting thread
+    const int missingContextId = contextId + 100;
+    CHECK_EQUAL(true, behaviac::Context::FindContext(missingContextId) == 0);
+    behaviac::Context::PostEvent(missingContextId, BEHAVIAC_NEW RecordedEvent_t(testAgent, 0, kPostedEvents, records));
+    behaviac::Context::execEvents(contextId);
+    CHECK_EQUAL(kPostedEvents, (int)records[0].size());
+    CHECK_EQUAL(true, behaviac::Context::FindContext(missingContextId) == 0);
+
+    //the events of a destroyed agent are dropped
+    testAgent->PostEvent("event_test_void");
+    behaviac::Agent::Destroy(testAgent);
+    behaviac::Context::execEvents(contextId);
+
+    for (int i = 0; i < createdContexts; ++i)
+    {
+        behaviac::Context::Cleanup(contextId + 1 + i);
+    }
+
+    behaviac::Context::Cleanup(contextId);
+
+    unregisterAllTypes();
+
+    behaviac::Profiler::DestroyInstance();
+}
+
+namespace
+{
+    const int kInvokingThreads = 4;
+    const int kInvokes = 20000;
+
+    struct InvokingContext_t
+    {
+        CMethodBase* method;
+        ParTestAgent* agent;
+        volatile behaviac::Atomic32* mismatches;
+        volatile behaviac::Atomic32* finished;
+    };
+
+    unsigned int __STDCALL InvokingThreadFunction(void* arg)
+    {
+        InvokingContext_t* ctx = (InvokingContext_t*)arg;
+
+        for (int i = 0; i < kInvokes; ++i)
+        {
+            kEmployee employee;
+            ctx->method->Invoke(ctx->agent, ctx->agent, employee);
+
+            if (employee.id != ctx->agent->TV_INT_0 + 3)
+            {
+                behaviac::AtomicInc(*ctx->mismatches);
+            }
+        }
+
+        behaviac::AtomicInc(*ctx->finished);
+
+        return 0;
+    }
+}
+
+LOAD_TEST(btunittest, struct_param_reentrant)
+{
+    //the method is loaded from its string, the result doesn't depend on the format
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    //loading a tree loads the properties of the agent types, which the bound field is created from
+    EmployeeParTestAgent* myTestAgent = initTestEnvPar("par_test/par_as_ref_param", format);
+
+    //the id of the struct argument is bound to the agent's property, the other fields are literals
+    CMethodBase* pMethod = behaviac::Action::LoadMethod("Self.ParTestAgent::Func_kEmployeeIR({boss=null;car={brand=\"\";color=RED;price=0;};"
+                                                        "code=c;id=int Self.ParTestAgent::TV_INT_0;isMale=false;name=\"tom\";skinColor=RED;weight=0;})");
+    CHECK_EQUAL(true, pMethod != 0);
+
+    ParTestAgent* agents[kInvokingThreads];
+    InvokingContext_t contexts[kInvokingThreads];
+    behaviac::thread::ThreadHandle threads[kInvokingThreads];
+    volatile behaviac::Atomic32 mismatches = 0;
+    volatile behaviac::Atomic32 finished = 0;
+
+    for (int i = 0; i < kInvokingThreads; ++i)
+    {
+        agents[i] = behaviac::Agent::Create<ParTestAgent>();
+        agents[i]->resetProperties();
+        agents[i]->TV_INT_0 = 100 * (i + 1);
+
+        contexts[i].method = pMethod;
+        contexts[i].agent = agents[i];
+        contexts[i].mismatches = &mismatches;
+        contexts[i].finished = &finished;
+    }
+
+    //the agents call the same method object at the same time, each argument is assembled in the caller's storage
+    for (int i = 0; i < kInvokingThreads; ++i)
+    {
+        threads[i] = behaviac::thread::CreateAndStartThread(&InvokingThreadFunction, &contexts[i], 0);
+        CHECK_EQUAL(true, threads[i] != 0);
+    }
+
+    while (finished < kInvokingThreads)
+    {
+        behaviac::Thread::Sleep(1);
+    }
+
+    for (int i = 0; i < kInvokingThreads; ++i)
+    {
+        behaviac::thread::StopThread(threads[i]);
+    }
+
+    CHECK_EQUAL(0, (int)mismatches);
+
+    for (int i = 0; i < kInvokingThreads; ++i)
+    {
+        behaviac::Agent::Destroy(agents[i]);
+    }
+
+    BEHAVIAC_DELETE(pMethod);
+
+    //a literal passed to a non const reference is copied for each call, the method doesn't change the loaded argument
+    CMethodBase* pIncMethod = behaviac::Action::LoadMethod("Self.ParTestAgent::Func_IntRefInc(5)");
+    CHECK_EQUAL(true, pIncMethod != 0);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        int result = 0;
+        pIncMethod->Invoke(myTestAgent, myTestAgent, result);
+        CHECK_EQUAL(6, result);
+    }
+
+    BEHAVIAC_DELETE(pIncMethod);
+
+    finlTestEnvPar(myTestAgent);
+}
+
+namespace
+{
+    const int kExecutingContexts = 2;
+    const int kExecutions = 2000;
+
+    struct ExecutingContext_t
+    {
+        const char* treePath;
+        EmployeeParTestAgent* agent;
+        volatile behaviac::Atomic32* mismatches;
+        volatile behaviac::Atomic32* finished;
+    };
+
+    unsigned int __STDCALL ExecutingThreadFunction(void* arg)
+    {
+        ExecutingContext_t* ctx = (ExecutingContext_t*)arg;
+        EmployeeParTestAgent* agent = ctx->agent;
+        behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+
+        for (int i = 0; i < kExecutions; ++i)
+        {
+            //the running loop is aborted so that the tree is entered again
+            agent->btgetcurrent()->abort(agent);
+            agent->SetVariable<int>("par1_int_0", 0);
+            agent->SetVariable<char>("par0_char_0", 'A');
+
+            //the tree ends with a loop, it keeps running once the actions are executed
+            if (agent->btexec() != behaviac::BT_RUNNING || behaviac::GetNodeId() != behaviac::INVALID_NODE_ID ||
+                agent->GetVariable<int>("par1_int_0") != 2 || agent->GetVariable<char>("par0_char_0") != 'X')
+            {
+                behaviac::AtomicInc(*ctx->mismatches);
+            }
+
+            //the tasks of the shared tree are created and destroyed concurrently
+            behaviac::BehaviorTreeTask* pTask = pWorkspace->CreateBehaviorTreeTask(ctx->treePath);
+            pWorkspace->DestroyBehaviorTreeTask(pTask, agent);
+        }
+
+        behaviac::AtomicInc(*ctx->finished);
+
+        return 0;
+    }
+}
+
+LOAD_TEST(btunittest, context_threads)
+{
+    //the result doesn't depend on the format
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    const char* treePath = "par_test/par_as_ref_param";
+    EmployeeParTestAgent* myTestAgent = initTestEnvPar(treePath, format);
+
+    //the tree is loaded and the contexts are created before they are executed on their own threads
+    EmployeeParTestAgent* agents[kExecutingContexts];
+    ExecutingContext_t contexts[kExecutingContexts];
+    behaviac::thread::ThreadHandle threads[kExecutingContexts];
+    volatile behaviac::Atomic32 mismatches = 0;
+    volatile behaviac::Atomic32 finished = 0;
+
+    for (int i = 0; i < kExecutingContexts; ++i)
+    {
+        agents[i] = behaviac::Agent::Create<EmployeeParTestAgent>(0, i + 1);
+        agents[i]->resetProperties();
+        agents[i]->btsetcurrent(treePath);
+        CHECK_EQUAL(true, agents[i]->btgetcurrent()->GetNode() == myTestAgent->btgetcurrent()->GetNode());
+
+        behaviac::Context::GetContext(i + 1).SetTimeSinceStartup(10.0f * i);
+
+        contexts[i].treePath = treePath;
+        contexts[i].agent = agents[i];
+        contexts[i].mismatches = &mismatches;
+        contexts[i].finished = &finished;
+    }
+
+    for (int i = 0; i < kExecutingContexts; ++i)
+    {
+        threads[i] = behaviac::thread::CreateAndStartThread(&ExecutingThreadFunction, &contexts[i], 0);
+        CHECK_EQUAL(true, threads[i] != 0);
+    }
+
+    //the agent of the default context shares the same tree on this thread meanwhile
+    for (int i = 0; i < kExecutions; ++i)
+    {
+        myTestAgent->resetProperties();
+        myTestAgent->btexec();
+    }
+
+    while (finished < kExecutingContexts)
+    {
+        behaviac::Thread::Sleep(1);
+    }
+
+    for (int i = 0; i < kExecutingContexts; ++i)
+    {
+        behaviac::thread::StopThread(threads[i]);
+    }
+
+    CHECK_EQUAL(0, (int)mismatches);
+
+    for (int i = 0; i < kExecutingContexts; ++i)
+    {
+        CHECK_FLOAT_EQUAL(10.0f * i, behaviac::Context::GetContext(i + 1).GetTimeSinceStartup());
+
+        behaviac::Agent::Destroy(agents[i]);
+        behaviac::Context::Cleanup(i + 1);
+    }
+
+    finlTestEnvPar(myTestAgent);
+}
+
 TEST(btunittest, agentInvoke)
 {
     EmployeeParTestAgent::clearAllStaticMemberVariables();
@@ -350,6 +711,1587 @@ TEST(btunittest, filemanager)
     BEHAVIAC_DELETE(pFileManager);
 }
 
+LOAD_TEST(btunittest, behaviortreetask_pool)
+{
+    const char* treePath = "node_test/action_noop_ut_0";
+    AgentNodeTest* myTestAgent = initTestEnvNode(treePath, format);
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::Workspace::BehaviorTreeTaskPoolStats_t stats;
+
+    CHECK_EQUAL(false, pWorkspace->GetBehaviorTreeTaskPoolStats(treePath, stats));
+    CHECK_EQUAL(true, pWorkspace->SetBehaviorTreeTaskPool(treePath, 2, 3));
+    CHECK_EQUAL(true, pWorkspace->GetBehaviorTreeTaskPoolStats(treePath, stats));
+    CHECK_EQUAL(2, stats.pooled);
+    CHECK_EQUAL(3, stats.highWaterMark);
+
+    behaviac::BehaviorTreeTask* tasks[4];
+
+    for (int i = 0; i < 4; ++i)
+    {
+        tasks[i] = pWorkspace->CreateBehaviorTreeTask(treePath);
+        CHECK_NOT_EQUAL((behaviac::BehaviorTreeTask*)0, tasks[i]);
+    }
+
+    pWorkspace->GetBehaviorTreeTaskPoolStats(treePath, stats);
+    CHECK_EQUAL(2, stats.hits);
+    CHECK_EQUAL(2, stats.misses);
+    CHECK_EQUAL(0, stats.pooled);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        pWorkspace->DestroyBehaviorTreeTask(tasks[i], myTestAgent);
+    }
+
+    pWorkspace->GetBehaviorTreeTaskPoolStats(treePath, stats);
+    CHECK_EQUAL(3, stats.pooled);
+    CHECK_EQUAL(1, stats.discarded);
+
+    //a pooled task is reset and can be executed again
+    behaviac::BehaviorTreeTask* task = pWorkspace->CreateBehaviorTreeTask(treePath);
+    myTestAgent->resetProperties();
+    CHECK_EQUAL(behaviac::BT_SUCCESS, task->exec(myTestAgent));
+    CHECK_EQUAL(2, myTestAgent->testVar_0);
+    pWorkspace->DestroyBehaviorTreeTask(task, myTestAgent);
+
+    behaviac::BehaviorTreeTask* task1 = pWorkspace->CreateBehaviorTreeTask(treePath);
+    CHECK_EQUAL(task, task1);
+    CHECK_EQUAL(behaviac::BT_INVALID, task1->GetStatus());
+    myTestAgent->resetProperties();
+    CHECK_EQUAL(behaviac::BT_SUCCESS, task1->exec(myTestAgent));
+    CHECK_EQUAL(2, myTestAgent->testVar_0);
+    pWorkspace->DestroyBehaviorTreeTask(task1, myTestAgent);
+
+    CHECK_EQUAL(true, pWorkspace->SetBehaviorTreeTaskPool(treePath, 0, 0));
+    CHECK_EQUAL(false, pWorkspace->GetBehaviorTreeTaskPoolStats(treePath, stats));
+
+    finlTestEnvNode(myTestAgent);
+}
+
+//counts how the files whose names contain 'm_pattern' are accessed
+class CFileManager_Counting : public CFileManager
+{
+public:
+    BEHAVIAC_DECLARE_MEMORY_OPERATORS(CFileManager_Counting);
+
+    CFileManager_Counting(const char* pattern) : CFileManager(), m_pattern(pattern), m_opened(0), m_mapped(0), m_unmapped(0), m_treesAtOpen(0), m_pMapped(0), m_mappedSize(0)
+    {
+    }
+
+    virtual IFile* FileOpen(const char* fileName, CFileSystem::EOpenAccess iOpenAccess = CFileSystem::EOpenAccess_Read)
+    {
+        if (strstr(fileName, m_pattern))
+        {
+            //the preloading threads open the files while no tree is created
+            behaviac::ScopedLock lock(m_cs);
+            m_opened++;
+            m_treesAtOpen = behaviac::Workspace::GetInstance()->GetBehaviorTrees().size();
+        }
+
+        return CFileManager::FileOpen(fileName, iOpenAccess);
+    }
+
+    virtual const char* FileMap(const char* fileName, uint32_t& fileSize)
+    {
+        const char* pData = CFileManager::FileMap(fileName, fileSize);
+
+        if (pData && strstr(fileName, m_pattern))
+        {
+            m_mapped++;
+            m_pMapped = pData;
+            m_mappedSize = fileSize;
+        }
+
+        return pData;
+    }
+
+    virtual void FileUnmap(const char* pData, uint32_t fileSize)
+    {
+        m_unmapped++;
+
+        CFileManager::FileUnmap(pData, fileSize);
+    }
+
+    const char* m_pattern;
+    int m_opened;
+    int m_mapped;
+    int m_unmapped;
+    size_t m_treesAtOpen;
+    const char* m_pMapped;
+    uint32_t m_mappedSize;
+    behaviac::Mutex m_cs;
+};
+
+typedef void (*LoadTestSetup_t)(behaviac::Workspace::EFileFormat format);
+
+//'setup' changes how the trees are loaded and checks the effect of it, while an agent is running node_test/action_noop_ut_0,
+//which is checked to run the same afterwards
+static void exec_action_noop_ut_0(behaviac::Workspace::EFileFormat format, LoadTestSetup_t setup)
+{
+    AgentNodeTest* myTestAgent = initTestEnvNode("node_test/action_noop_ut_0", format);
+
+    setup(format);
+
+    myTestAgent->resetProperties();
+    behaviac::EBTStatus status = myTestAgent->btexec();
+    CHECK_EQUAL(2, myTestAgent->testVar_0);
+    CHECK_EQUAL(behaviac::BT_SUCCESS, status);
+    finlTestEnvNode(myTestAgent);
+}
+
+static void setup_bson_file_mapping(behaviac::Workspace::EFileFormat format)
+{
+    BEHAVIAC_UNUSED_VAR(format);
+
+    const char* treePath = "node_test/wait_ut_0";
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+
+    CFileManager::Cleanup();
+    CFileManager_Counting* pFileManager = BEHAVIAC_NEW CFileManager_Counting("wait_ut_0");
+
+    const behaviac::Workspace::BehaviorTrees_t& bts = pWorkspace->GetBehaviorTrees();
+
+    //mapped instead of read, the tree keeps the mapping and the class names of its nodes point into it
+    pWorkspace->SetFileMapping(true);
+    CHECK_EQUAL(true, pWorkspace->Load(treePath, true));
+
+    CHECK_EQUAL(1, pFileManager->m_mapped);
+    CHECK_EQUAL(0, pFileManager->m_unmapped);
+    CHECK_EQUAL(0, pFileManager->m_opened);
+
+    const char* className = bts.find(treePath)->second->GetChild(0)->GetClassNameString();
+    CHECK_EQUAL(true, className >= pFileManager->m_pMapped && className < pFileManager->m_pMapped + pFileManager->m_mappedSize);
+
+    //the shared nodes outlive the tree, the mapping is released right after parsing
+    bool bSubtreeSharing = pWorkspace->IsSubtreeSharing();
+    pWorkspace->SetSubtreeSharing(true);
+    CHECK_EQUAL(true, pWorkspace->Load(treePath, true));
+
+    CHECK_EQUAL(2, pFileManager->m_mapped);
+    CHECK_EQUAL(2, pFileManager->m_unmapped);
+
+    pWorkspace->SetSubtreeSharing(bSubtreeSharing);
+
+    //read as before when it is disabled
+    pWorkspace->SetFileMapping(false);
+    CHECK_EQUAL(true, pWorkspace->Load(treePath, true));
+
+    CHECK_EQUAL(2, pFileManager->m_mapped);
+    CHECK_EQUAL(2, pFileManager->m_unmapped);
+    CHECK_EQUAL(1, pFileManager->m_opened);
+
+    className = bts.find(treePath)->second->GetChild(0)->GetClassNameString();
+    CHECK_EQUAL(false, className >= pFileManager->m_pMapped && className < pFileManager->m_pMapped + pFileManager->m_mappedSize);
+
+    BEHAVIAC_DELETE(pFileManager);
+}
+
+LOAD_TEST(btunittest, bson_file_mapping)
+{
+    if (format != behaviac::Workspace::EFF_bson)
+    {
+        return;
+    }
+
+    exec_action_noop_ut_0(format, &setup_bson_file_mapping);
+}
+
+static void setup_preload(behaviac::Workspace::EFileFormat format)
+{
+    BEHAVIAC_UNUSED_VAR(format);
+
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+
+    behaviac::vector<behaviac::string> relativePaths;
+    relativePaths.push_back("node_test/event_ut_1");
+    relativePaths.push_back("node_test/wait_ut_0");
+    relativePaths.push_back("node_test/event_ut_1");
+    relativePaths.push_back("node_test/action_noop_ut_0");
+
+    //the duplicated and the already loaded trees are not counted
+    CHECK_EQUAL(2, pWorkspace->Preload(relativePaths, 2));
+
+    const behaviac::Workspace::BehaviorTrees_t& bts = pWorkspace->GetBehaviorTrees();
+    CHECK_EQUAL(true, bts.find("node_test/event_ut_1") != bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/wait_ut_0") != bts.end());
+
+    CHECK_EQUAL(0, pWorkspace->Preload(relativePaths, 4));
+}
+
+LOAD_TEST(btunittest, preload)
+{
+    exec_action_noop_ut_0(format, &setup_preload);
+}
+
+static void setup_preload_all(behaviac::Workspace::EFileFormat format)
+{
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    pWorkspace->SetFileFormat(behaviac::Workspace::EFF_default);
+
+    const behaviac::Workspace::BehaviorTrees_t& bts = pWorkspace->GetBehaviorTrees();
+    size_t loadedCount = bts.size();
+
+    CFileManager::Cleanup();
+    CFileManager_Counting* pFileManager = BEHAVIAC_NEW CFileManager_Counting("node_test/");
+
+    uint32_t count = pWorkspace->PreloadAll(2);
+    CHECK_EQUAL(true, count > 0);
+
+    CHECK_EQUAL(true, bts.find("node_test/event_ut_1") != bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/wait_ut_0") != bts.end());
+
+    //all the files are read ahead instead of being loaded one after another
+    CHECK_EQUAL(true, pFileManager->m_opened > 0);
+    CHECK_EQUAL(loadedCount, pFileManager->m_treesAtOpen);
+
+    BEHAVIAC_DELETE(pFileManager);
+
+    pWorkspace->SetFileFormat(format);
+}
+
+LOAD_TEST(btunittest, preload_all)
+{
+    //the format is combined, the result doesn't depend on the running one
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    exec_action_noop_ut_0(format, &setup_preload_all);
+}
+
+namespace
+{
+    const int kAllocatingBlocks = 1024;
+
+    struct AllocatingContext_t
+    {
+        volatile behaviac::Atomic32 started;
+        volatile behaviac::Atomic32 stopped;
+        void* blocks[kAllocatingBlocks];
+    };
+
+    unsigned int __STDCALL AllocatingThreadFunction(void* arg)
+    {
+        AllocatingContext_t* ctx = (AllocatingContext_t*)arg;
+        int count = 0;
+
+        while (ctx->stopped == 0)
+        {
+            if (count == kAllocatingBlocks)
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    BEHAVIAC_FREE_WITHTAG(ctx->blocks[i], "AllocatingThreadFunction");
+                }
+
+                count = 0;
+            }
+
+            ctx->blocks[count++] = BEHAVIAC_MALLOC_WITHTAG(256, "AllocatingThreadFunction");
+
+            if (ctx->started == 0)
+            {
+                behaviac::AtomicInc(ctx->started);
+            }
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            BEHAVIAC_FREE_WITHTAG(ctx->blocks[i], "AllocatingThreadFunction");
+        }
+
+        return 0;
+    }
+}
+
+static void setup_memory_budget(behaviac::Workspace::EFileFormat format)
+{
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    const behaviac::Workspace::BehaviorTrees_t& bts = pWorkspace->GetBehaviorTrees();
+
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/reference_ut_0"));
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/wait_ut_1"));
+    CHECK_EQUAL(true, pWorkspace->GetResidentBytes("node_test/wait_ut_1") > 0);
+    CHECK_EQUAL(true, pWorkspace->GetResidentBytes() >= pWorkspace->GetResidentBytes("node_test/wait_ut_1") + pWorkspace->GetResidentBytes("node_test/reference_ut_0"));
+
+    //the allocations of the other threads while loading are not counted
+    pWorkspace->UnLoad("node_test/wait_ut_1");
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/wait_ut_1"));
+    uint32_t residentBytes = pWorkspace->GetResidentBytes("node_test/wait_ut_1");
+    pWorkspace->UnLoad("node_test/wait_ut_1");
+    CHECK_EQUAL(0, pWorkspace->GetResidentBytes("node_test/wait_ut_1"));
+
+    AllocatingContext_t allocating;
+    allocating.started = 0;
+    allocating.stopped = 0;
+    behaviac::thread::ThreadHandle thread = behaviac::thread::CreateAndStartThread(&AllocatingThreadFunction, &allocating, 0);
+    CHECK_EQUAL(true, thread != 0);
+
+    while (allocating.started == 0)
+    {
+        behaviac::Thread::Sleep(1);
+    }
+
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/wait_ut_1"));
+    behaviac::AtomicInc(allocating.stopped);
+    behaviac::thread::StopThread(thread);
+    CHECK_EQUAL(residentBytes, pWorkspace->GetResidentBytes("node_test/wait_ut_1"));
+
+    //the trees used by the live tasks and the ones referenced by them are kept
+    behaviac::BehaviorTreeTask* task = pWorkspace->CreateBehaviorTreeTask("node_test/reference_ut_0");
+    pWorkspace->SetMemoryBudget(1);
+
+    CHECK_EQUAL(true, bts.find("node_test/action_noop_ut_0") != bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/reference_ut_0") != bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/reference_sub_0") != bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/wait_ut_1") == bts.end());
+    CHECK_EQUAL(0, pWorkspace->GetResidentBytes("node_test/wait_ut_1"));
+
+    pWorkspace->DestroyBehaviorTreeTask(task, 0);
+    CHECK_EQUAL(true, pWorkspace->EnforceMemoryBudget() >= 2);
+    CHECK_EQUAL(true, bts.find("node_test/reference_ut_0") == bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/reference_sub_0") == bts.end());
+
+    pWorkspace->SetMemoryBudget(0);
+
+    //the evicted trees are loaded again ahead of need
+    behaviac::vector<behaviac::string> relativePaths;
+    relativePaths.push_back("node_test/reference_ut_0");
+    relativePaths.push_back("node_test/wait_ut_1");
+
+    pWorkspace->LoadAsync(relativePaths);
+
+    //there is no file to read ahead for cpp, they are loaded in LoadAsync
+    CHECK_EQUAL(format == behaviac::Workspace::EFF_cpp ? 0 : 2, pWorkspace->FinishAsyncLoads(true));
+    CHECK_EQUAL(true, bts.find("node_test/reference_ut_0") != bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/reference_sub_0") != bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/wait_ut_1") != bts.end());
+}
+
+LOAD_TEST(btunittest, memory_budget)
+{
+    exec_action_noop_ut_0(format, &setup_memory_budget);
+}
+
+static void setup_saved_state_budget(behaviac::Workspace::EFileFormat format)
+{
+    BEHAVIAC_UNUSED_VAR(format);
+
+    const char* treePath = "node_test/wait_ut_1";
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    const behaviac::Workspace::BehaviorTrees_t& bts = pWorkspace->GetBehaviorTrees();
+
+    AgentNodeTest* testAgent = behaviac::Agent::Create<AgentNodeTest>();
+    testAgent->resetProperties();
+    testAgent->btsetcurrent(treePath);
+    CHECK_EQUAL(behaviac::BT_RUNNING, testAgent->btexec());
+
+    //the tasks of the saved states and the restored ones are live tasks of the tree
+    {
+        behaviac::State_t state;
+        CHECK_EQUAL(true, testAgent->btsave(state));
+
+        behaviac::State_t copied(state);
+        CHECK_EQUAL(true, testAgent->btload(copied));
+
+        pWorkspace->SetMemoryBudget(1);
+        CHECK_EQUAL(true, bts.find(treePath) != bts.end());
+    }
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, testAgent->btexec());
+    CHECK_EQUAL(true, bts.find(treePath) != bts.end());
+
+    //all of them are destroyed by the workspace, so the tree can be unloaded after the agent is gone
+    behaviac::Agent::Destroy(testAgent);
+    pWorkspace->EnforceMemoryBudget();
+    CHECK_EQUAL(true, bts.find(treePath) == bts.end());
+
+    pWorkspace->SetMemoryBudget(0);
+}
+
+LOAD_TEST(btunittest, saved_state_budget)
+{
+    exec_action_noop_ut_0(format, &setup_saved_state_budget);
+}
+
+LOAD_TEST(btunittest, hot_reload_incremental)
+{
+#if BEHAVIAC_ENABLE_HOTRELOAD
+    AgentNodeTest* myTestAgent = initTestEnvNode("node_test/wait_ut_1", format);
+    myTestAgent->resetProperties();
+
+    behaviac::EBTStatus status = myTestAgent->btexec();
+    CHECK_EQUAL(behaviac::BT_RUNNING, status);
+    CHECK_EQUAL(1, myTestAgent->testVar_0);
+
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    const behaviac::BehaviorTreeTask* btTask = myTestAgent->btgetcurrent();
+    const behaviac::BehaviorNode* pTree = btTask->GetNode();
+    const behaviac::BehaviorNode* pWaitNode = pTree->GetChild(0)->GetChild(1);
+    const behaviac::BehaviorTask* pWait = btTask->GetCurrentTask();
+    CHECK_EQUAL(true, pWait != 0 && pWait->GetNode() == pWaitNode);
+    CHECK_EQUAL(behaviac::BT_RUNNING, pWait->GetStatus());
+
+    //the nodes are reloaded, the running wait is kept and the action before it is not executed again
+    myTestAgent->testVar_0 = 0;
+    CHECK_EQUAL(true, pWorkspace->HotReload("node_test/wait_ut_1"));
+    CHECK_EQUAL(true, pTree == btTask->GetNode());
+    CHECK_EQUAL(true, pWait == btTask->GetCurrentTask());
+    CHECK_EQUAL(true, pWaitNode != pTree->GetChild(0)->GetChild(1));
+    CHECK_EQUAL(true, pWait->GetNode() == pTree->GetChild(0)->GetChild(1));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pWait->GetStatus());
+
+    status = myTestAgent->btexec();
+    CHECK_EQUAL(behaviac::BT_RUNNING, status);
+    CHECK_EQUAL(0, myTestAgent->testVar_0);
+
+    CHECK_EQUAL(false, pWorkspace->HotReload("node_test/not_exported"));
+
+    //the files are read on a worker thread, the tree is reloaded when the request is finished
+    behaviac::vector<behaviac::string> relativePaths;
+    relativePaths.push_back("node_test/wait_ut_1");
+    pWorkspace->HotReloadAsync(relativePaths);
+
+    CHECK_EQUAL(format == behaviac::Workspace::EFF_cpp ? 0 : 1, pWorkspace->FinishAsyncLoads(true));
+    CHECK_EQUAL(true, pWait == btTask->GetCurrentTask());
+    CHECK_EQUAL(true, pWait->GetNode() == pTree->GetChild(0)->GetChild(1));
+
+    status = myTestAgent->btexec();
+    CHECK_EQUAL(behaviac::BT_RUNNING, status);
+    CHECK_EQUAL(0, myTestAgent->testVar_0);
+    finlTestEnvNode(myTestAgent);
+#else
+    BEHAVIAC_UNUSED_VAR(format);
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+}
+
+LOAD_TEST(btunittest, context_clock)
+{
+    const char* treePath = "node_test/wait_ut_1";
+    AgentNodeTest* myTestAgent = initTestEnvNode(treePath, format);
+    myTestAgent->resetProperties();
+
+    //the other agent runs the same loaded tree in its own context, which keeps its own clock
+    AgentNodeTest* otherAgent = behaviac::Agent::Create<AgentNodeTest>(0, 1);
+    otherAgent->resetProperties();
+    otherAgent->btsetcurrent(treePath);
+    CHECK_EQUAL(true, myTestAgent->btgetcurrent()->GetNode() == otherAgent->btgetcurrent()->GetNode());
+
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    float timeSinceStartup = pWorkspace->GetTimeSinceStartup();
+    behaviac::Context& context = behaviac::Context::GetContext(1);
+
+    pWorkspace->SetTimeSinceStartup(0.0f);
+    CHECK_FLOAT_EQUAL(0.0f, context.GetTimeSinceStartup());
+    context.SetTimeSinceStartup(0.0f);
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(behaviac::BT_RUNNING, otherAgent->btexec());
+
+    //wait_ut_1 waits for 1 second, ignoring the time scale
+    context.SetTimeSinceStartup(2.0f);
+    CHECK_FLOAT_EQUAL(0.0f, pWorkspace->GetTimeSinceStartup());
+    CHECK_EQUAL(behaviac::BT_SUCCESS, otherAgent->btexec());
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+
+    pWorkspace->SetTimeSinceStartup(2.0f);
+    CHECK_EQUAL(behaviac::BT_SUCCESS, myTestAgent->btexec());
+
+    pWorkspace->SetTimeSinceStartup(timeSinceStartup);
+
+    behaviac::Agent::Destroy(otherAgent);
+    behaviac::Context::Cleanup(1);
+    finlTestEnvNode(myTestAgent);
+}
+
+LOAD_TEST(btunittest, subtree_sharing)
+{
+    if (format == behaviac::Workspace::EFF_cpp)
+    {
+        return;
+    }
+
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    pWorkspace->SetSubtreeSharing(true);
+
+    AgentNodeTest* myTestAgent = initTestEnvNode("node_test/selector_loop_ut_0", format);
+    behaviac::BehaviorTree* pTree0 = pWorkspace->LoadBehaviorTree("node_test/selector_loop_ut_0");
+    behaviac::BehaviorTree* pTree5 = pWorkspace->LoadBehaviorTree("node_test/selector_loop_ut_5");
+    CHECK_EQUAL(true, pTree0 != 0 && pTree5 != 0);
+
+    //WithPrecondition[2] of selector_loop_ut_0 is the same as WithPrecondition[7] of selector_loop_ut_5
+    const behaviac::BehaviorNode* pShared = pTree0->GetChild(0)->GetChild(1);
+    CHECK_EQUAL(true, pShared == pTree5->GetChild(0)->GetChild(2));
+    CHECK_EQUAL(true, pTree0->GetChild(0)->GetChild(0) != pTree5->GetChild(0)->GetChild(0));
+
+    //a shared node has no single parent, the ones which are not shared keep theirs
+    CHECK_EQUAL(true, pShared->GetParent() == 0);
+    CHECK_EQUAL(true, pTree0->GetChild(0)->GetChild(0)->GetParent() == pTree0->GetChild(0));
+
+    //the tasks keep the ids in their own trees
+    AgentNodeTest* otherAgent = behaviac::Agent::Create<AgentNodeTest>();
+    otherAgent->btsetcurrent("node_test/selector_loop_ut_5");
+
+    const behaviac::BehaviorTask* pTree0Task = myTestAgent->btgetcurrent();
+    const behaviac::BehaviorTask* pTree5Task = otherAgent->btgetcurrent();
+    const behaviac::BehaviorTask* pTask0 = pTree0Task->GetTaskById(2);
+    const behaviac::BehaviorTask* pTask5 = pTree5Task->GetTaskById(7);
+    CHECK_EQUAL(true, pTask0 != 0 && pTask5 != 0);
+    CHECK_EQUAL(true, pTask0->GetNode() == pShared && pTask5->GetNode() == pShared);
+    CHECK_EQUAL(true, pTree5Task->GetTaskById(9) != 0);
+    CHECK_EQUAL(true, pTree5Task->GetTaskById(2)->GetNode() != pShared);
+
+    myTestAgent->resetProperties();
+    CHECK_EQUAL(behaviac::BT_SUCCESS, myTestAgent->btexec());
+    CHECK_EQUAL(0, myTestAgent->testVar_0);
+
+    //the shared nodes are kept by the other tree
+    myTestAgent->btunload("node_test/selector_loop_ut_0");
+    CHECK_EQUAL(true, strcmp(pTask5->GetClassNameString(), "WithPrecondition") == 0);
+    CHECK_EQUAL(true, pShared->GetParent() == 0);
+
+    pWorkspace->SetSubtreeSharing(false);
+
+    behaviac::Agent::Destroy(otherAgent);
+    finlTestEnvNode(myTestAgent);
+}
+
+//sets par_int_type_0, par_int_type_1 and testVar_1 read by the preconditions of node_test/selector_loop_ut_6
+static void set_selector_loop_ut_6_inputs(AgentNodeTest* pAgent, uint32_t seed)
+{
+    //a few values around the thresholds of the conditions, some ticks keep the inputs of the last one
+    if (seed % 3 != 0)
+    {
+        pAgent->SetVariable("par_int_type_0", (int)(seed >> 4) % 3 * 5 + 1);
+        pAgent->SetVariable("par_int_type_1", (int)(seed >> 8) % 2);
+        pAgent->testVar_1 = (int)(seed >> 12) % 2;
+    }
+}
+
+//the pars are out of scope between the ticks, their values are kept by the variables
+static int& get_selector_loop_ut_6_par(AgentNodeTest* pAgent, const char* parName)
+{
+    behaviac::TVariable<int>* pPar = (behaviac::TVariable<int>*)pAgent->m_variables.Vars()[behaviac::MakeVariableId(parName)];
+
+    return (int&)pPar->GetValue();
+}
+
+LOAD_TEST(btunittest, precondition_caching)
+{
+    //selector_loop_ut_6 is only exported as xml
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    AgentNodeTest* myTestAgent = initTestEnvNode("node_test/selector_loop_ut_6", format);
+    behaviac::BehaviorTree* pTree = behaviac::Workspace::GetInstance()->LoadBehaviorTree("node_test/selector_loop_ut_6");
+    CHECK_EQUAL(true, pTree != 0);
+
+    //the condition on the member is not tracked
+    const behaviac::BehaviorNode* pSelectorLoop = pTree->GetChild(0);
+    const behaviac::WithPrecondition* pBranch0 = behaviac::WithPrecondition::DynamicCast(pSelectorLoop->GetChild(0));
+    const behaviac::WithPrecondition* pBranch1 = behaviac::WithPrecondition::DynamicCast(pSelectorLoop->GetChild(1));
+    const behaviac::WithPrecondition* pBranch2 = behaviac::WithPrecondition::DynamicCast(pSelectorLoop->GetChild(2));
+    const behaviac::WithPrecondition* pBranch3 = behaviac::WithPrecondition::DynamicCast(pSelectorLoop->GetChild(3));
+    CHECK_EQUAL(true, pBranch0->IsPreconditionTracked());
+    CHECK_EQUAL(1, (int)pBranch0->GetPreconditionReads().size());
+    CHECK_EQUAL(behaviac::MakeVariableId("par_int_type_0"), pBranch0->GetPreconditionReads()[0]);
+    CHECK_EQUAL(true, pBranch1->IsPreconditionTracked());
+    CHECK_EQUAL(behaviac::MakeVariableId("par_int_type_1"), pBranch1->GetPreconditionReads()[0]);
+    CHECK_EQUAL(false, pBranch2->IsPreconditionTracked());
+    CHECK_EQUAL(true, pBranch3->IsPreconditionTracked());
+    CHECK_EQUAL(0, (int)pBranch3->GetPreconditionReads().size());
+
+    //setting a par to the same value doesn't change it
+    myTestAgent->resetProperties();
+    myTestAgent->SetVariable("par_int_type_0", 5);
+    uint32_t version = myTestAgent->m_variables.GetVersion();
+    behaviac::vector<uint32_t> variableIds;
+    variableIds.push_back(behaviac::MakeVariableId("par_int_type_0"));
+    myTestAgent->SetVariable("par_int_type_0", 5);
+    CHECK_EQUAL(true, myTestAgent->m_variables.IsUnchangedSince(version, variableIds));
+    myTestAgent->SetVariable("par_int_type_0", 6);
+    CHECK_EQUAL(false, myTestAgent->m_variables.IsUnchangedSince(version, variableIds));
+
+    //the other agent runs the same tree in lock step with the preconditions cached, the decisions must be the same
+    AgentNodeTest* cachingAgent = behaviac::Agent::Create<AgentNodeTest>();
+    cachingAgent->resetProperties();
+    cachingAgent->btsetcurrent("node_test/selector_loop_ut_6");
+
+    uint32_t seed = 12345;
+    int decisions[5] = { 0 };
+
+    for (int i = 0; i < 300; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        set_selector_loop_ut_6_inputs(myTestAgent, seed);
+        set_selector_loop_ut_6_inputs(cachingAgent, seed);
+        myTestAgent->testVar_0 = 0;
+        cachingAgent->testVar_0 = 0;
+
+        pTree->SetPreconditionCaching(false);
+        behaviac::EBTStatus status = myTestAgent->btexec();
+
+        pTree->SetPreconditionCaching(true);
+        behaviac::EBTStatus cachedStatus = cachingAgent->btexec();
+
+        //every branch succeeds, so each tick picks the first branch whose precondition holds
+        int expected = get_selector_loop_ut_6_par(myTestAgent, "par_int_type_0") > 10 ? 1 :
+                       get_selector_loop_ut_6_par(myTestAgent, "par_int_type_1") == 1 ? 2 :
+                       myTestAgent->testVar_1 == 1 ? 3 : 4;
+        CHECK_EQUAL(behaviac::BT_SUCCESS, status);
+        CHECK_EQUAL(expected, myTestAgent->testVar_0);
+        CHECK_EQUAL(status, cachedStatus);
+        CHECK_EQUAL(myTestAgent->testVar_0, cachingAgent->testVar_0);
+        decisions[myTestAgent->testVar_0]++;
+    }
+
+    //all the branches are taken
+    CHECK_EQUAL(true, decisions[1] > 0 && decisions[2] > 0 && decisions[3] > 0 && decisions[4] > 0);
+
+    //a par written behind the runtime's back is not seen by a cached precondition
+    cachingAgent->SetVariable("par_int_type_0", 1);
+    cachingAgent->SetVariable("par_int_type_1", 0);
+    cachingAgent->testVar_1 = 0;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        cachingAgent->btexec();
+    }
+
+    CHECK_EQUAL(4, cachingAgent->testVar_0);
+    get_selector_loop_ut_6_par(cachingAgent, "par_int_type_0") = 11;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        cachingAgent->btexec();
+        CHECK_EQUAL(4, cachingAgent->testVar_0);
+    }
+
+    pTree->SetPreconditionCaching(false);
+
+    behaviac::Agent::Destroy(cachingAgent);
+    finlTestEnvNode(myTestAgent);
+}
+
+LOAD_TEST(btunittest, task_index)
+{
+    AgentNodeTest* myTestAgent = initTestEnvNode("node_test/selector_loop_ut_0", format);
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+
+    const char* treePaths[] = { "node_test/selector_loop_ut_0", "node_test/fsm/fsm_ut_1" };
+
+    for (int t = 0; t < 2; ++t)
+    {
+        behaviac::BehaviorTreeTask* pTreeTask = pWorkspace->CreateBehaviorTreeTask(treePaths[t]);
+        CHECK_EQUAL(true, pTreeTask != 0);
+
+        behaviac::vector<behaviac::BehaviorTask*> tasks;
+        pTreeTask->collecttasks(tasks);
+        CHECK_EQUAL(true, tasks.size() > 1);
+
+        //the indexed lookup finds the same task as walking the tasks
+        for (uint32_t i = 0; i < tasks.size(); ++i)
+        {
+            int id = tasks[i]->GetId();
+
+            if (id != -1)
+            {
+                const behaviac::BehaviorTask* pTask = pTreeTask->GetTaskById(id);
+                CHECK_EQUAL(true, pTask != 0 && pTask->GetId() == id);
+            }
+        }
+
+        CHECK_EQUAL(true, pTreeTask->GetTaskById(1000) == 0);
+
+        pWorkspace->DestroyBehaviorTreeTask(pTreeTask, myTestAgent);
+    }
+
+    //the attachments are not found, as before
+    behaviac::BehaviorTreeTask* pFSMTask = pWorkspace->CreateBehaviorTreeTask("node_test/fsm/fsm_ut_1");
+    CHECK_EQUAL(true, pFSMTask->GetTaskById(10) == 0);
+    CHECK_EQUAL(true, pFSMTask->GetTaskById(3) != 0);
+    pWorkspace->DestroyBehaviorTreeTask(pFSMTask, myTestAgent);
+
+    finlTestEnvNode(myTestAgent);
+}
+
+//the files written by the tests are kept out of the working directory, and each test deletes its own ones
+static behaviac::string GetTestTempPath(const char* relativePath)
+{
+#if BEHAVIAC_COMPILER_MSVC
+    const char* tempDir = getenv("TEMP");
+    behaviac::string root = tempDir ? tempDir : ".";
+#else
+    const char* tempDir = getenv("TMPDIR");
+    behaviac::string root = tempDir ? tempDir : "/tmp";
+#endif
+
+    return behaviac::StringUtils::CombineDir(root.c_str(), relativePath);
+}
+
+static void ReadTestFile(const char* path, behaviac::vector<char>& content)
+{
+    IFile* fp = CFileManager::GetInstance()->FileOpen(path, CFileSystem::EOpenAccess_Read);
+    CHECK_NOT_EQUAL(0, fp);
+
+    content.resize((uint32_t)fp->GetSize());
+    fp->Read(&content[0], (uint32_t)content.size());
+    CFileManager::GetInstance()->FileClose(fp);
+}
+
+static void WriteTestFile(const char* path, const behaviac::vector<char>& content)
+{
+    IFile* fp = CFileManager::GetInstance()->FileOpen(path, CFileSystem::EOpenAccess_Write);
+    CHECK_NOT_EQUAL(0, fp);
+
+    fp->Write(&content[0], (uint32_t)content.size());
+    CFileManager::GetInstance()->FileClose(fp);
+}
+
+//loads the archive with the 32 bits at 'offset' replaced by 'value'
+static bool LoadCorruptedArchive(const behaviac::vector<char>& archive, uint32_t offset, uint32_t value)
+{
+    behaviac::vector<char> corrupted = archive;
+    memcpy(&corrupted[offset], &value, sizeof(value));
+
+    behaviac::string path = GetTestTempPath("btunittest_archive_bad.bytes");
+    WriteTestFile(path.c_str(), corrupted);
+
+    return behaviac::Workspace::GetInstance()->LoadArchive(path.c_str());
+}
+
+static void setup_archive(behaviac::Workspace::EFileFormat format)
+{
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string archivePath = GetTestTempPath("btunittest_archive.bytes");
+    behaviac::string badArchivePath = GetTestTempPath("btunittest_archive_bad.bytes");
+
+    CHECK_EQUAL(true, pWorkspace->ExportArchive(archivePath.c_str()));
+    CHECK_EQUAL(true, pWorkspace->LoadArchive(archivePath.c_str()));
+
+    CHECK_EQUAL(true, pWorkspace->IsArchived("node_test/wait_ut_1"));
+    CHECK_EQUAL(true, pWorkspace->IsArchived("node_test/action_noop_ut_0"));
+    CHECK_EQUAL(false, pWorkspace->IsArchived("node_test/not_exported"));
+    CHECK_EQUAL(false, pWorkspace->IsArchived("behaviac.bb"));
+
+    //the archived tree is loaded without opening its file, unless it is archived in another format
+    CFileManager::Cleanup();
+    CFileManager_Counting* pFileManager = BEHAVIAC_NEW CFileManager_Counting("wait_ut_1");
+
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/wait_ut_1", true));
+    CHECK_EQUAL(0, pFileManager->m_opened);
+
+    pWorkspace->SetFileFormat(format == behaviac::Workspace::EFF_xml ? behaviac::Workspace::EFF_bson : behaviac::Workspace::EFF_xml);
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/wait_ut_1", true));
+    CHECK_EQUAL(1, pFileManager->m_opened);
+
+    pWorkspace->SetFileFormat(format);
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/wait_ut_1", true));
+    CHECK_EQUAL(1, pFileManager->m_opened);
+
+    BEHAVIAC_DELETE(pFileManager);
+
+    //the archives with any offset or size out of the range are rejected as a whole
+    behaviac::vector<char> archive;
+    ReadTestFile(archivePath.c_str(), archive);
+
+    const uint32_t kHeaderSize = 6 * sizeof(uint32_t);
+    const uint32_t kEntrySize = 5 * sizeof(uint32_t);
+    uint32_t entryOffset = kHeaderSize;
+
+    while (*(const uint32_t*)&archive[entryOffset + 4] == 0xffffffff)
+    {
+        entryOffset += kEntrySize;
+    }
+
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, 12, 0));
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, 12, 3));
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, 12, 0x40000000));
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, 16, kHeaderSize));
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, 20, 0xfffffff0));
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, entryOffset + 4, (uint32_t)archive.size()));
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, entryOffset + 12, 0xfffffff0));
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, entryOffset + 16, 0xfffffff0));
+    CHECK_EQUAL(false, LoadCorruptedArchive(archive, entryOffset + 16, (uint32_t)archive.size()));
+    CHECK_EQUAL(false, pWorkspace->IsArchived("node_test/wait_ut_1"));
+
+    archive.resize(archive.size() - 1);
+    WriteTestFile(badArchivePath.c_str(), archive);
+    CHECK_EQUAL(false, pWorkspace->LoadArchive(badArchivePath.c_str()));
+
+    pWorkspace->UnLoadArchive();
+
+    CFileSystem::Delete(archivePath.c_str(), false);
+    CFileSystem::Delete(badArchivePath.c_str(), false);
+}
+
+LOAD_TEST(btunittest, archive)
+{
+    if (format == behaviac::Workspace::EFF_cpp)
+    {
+        return;
+    }
+
+    exec_action_noop_ut_0(format, &setup_archive);
+}
+
+static void setup_compressed_bson(behaviac::Workspace::EFileFormat format)
+{
+    BEHAVIAC_UNUSED_VAR(format);
+
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string exportPath = pWorkspace->GetFilePath();
+    behaviac::string path = behaviac::StringUtils::CombineDir(exportPath.c_str(), "node_test/wait_ut_0.bson.bytes");
+
+    behaviac::string lzDir = GetTestTempPath("btunittest_lz");
+    behaviac::string lzPath = lzDir + "/";
+    behaviac::string lzTreePath = lzPath + "node_test/wait_ut_0.bson.bytes";
+    behaviac::string lzCorruptedPath = lzPath + "node_test/corrupted_ut.bson.bytes";
+    behaviac::string lzMetaPath = lzPath + "behaviac.bb.bson.bytes";
+    behaviac::string archivePath = GetTestTempPath("btunittest_archive_lz.bytes");
+
+    //the loose compressed file is decompressed while being read
+    CFileSystem::MakeSureDirectoryExist((lzPath + "node_test/").c_str());
+    CHECK_EQUAL(true, pWorkspace->CompressFile(path.c_str(), lzTreePath.c_str()));
+
+    path = behaviac::StringUtils::CombineDir(exportPath.c_str(), "behaviac.bb.bson.bytes");
+    CHECK_EQUAL(true, pWorkspace->CompressFile(path.c_str(), lzMetaPath.c_str()));
+
+    pWorkspace->SetFilePath(lzPath.c_str());
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/wait_ut_0", true));
+
+    //the untrusted content size is checked against the compressed size before anything is allocated
+    behaviac::vector<char> compressed;
+    ReadTestFile(lzTreePath.c_str(), compressed);
+
+    const uint32_t kContentSizeOffset = 2 * sizeof(uint32_t);
+    const uint32_t corruptedSizes[] = { 0xffffffff, (uint32_t)compressed.size() * 64 * 1024 };
+
+    for (uint32_t i = 0; i < sizeof(corruptedSizes) / sizeof(corruptedSizes[0]); ++i)
+    {
+        behaviac::vector<char> corrupted = compressed;
+        memcpy(&corrupted[kContentSizeOffset], &corruptedSizes[i], sizeof(uint32_t));
+        WriteTestFile(lzCorruptedPath.c_str(), corrupted);
+
+        CHECK_EQUAL(false, pWorkspace->Load("node_test/corrupted_ut", true));
+    }
+
+    pWorkspace->SetFilePath(exportPath.c_str());
+
+    //the compressed bson in the archive, loaded without opening its file
+    CHECK_EQUAL(true, pWorkspace->ExportArchive(archivePath.c_str(), true));
+    CHECK_EQUAL(true, pWorkspace->LoadArchive(archivePath.c_str()));
+
+    CFileManager::Cleanup();
+    CFileManager_Counting* pFileManager = BEHAVIAC_NEW CFileManager_Counting("wait_ut_1");
+
+    CHECK_EQUAL(true, pWorkspace->Load("node_test/wait_ut_1", true));
+    CHECK_EQUAL(0, pFileManager->m_opened);
+
+    BEHAVIAC_DELETE(pFileManager);
+
+    pWorkspace->UnLoadArchive();
+
+    CFileSystem::Delete(archivePath.c_str(), false);
+    CFileSystem::Delete(lzTreePath.c_str(), false);
+    CFileSystem::Delete(lzCorruptedPath.c_str(), false);
+    CFileSystem::Delete(lzMetaPath.c_str(), false);
+    CFileSystem::removeDirectory((lzPath + "node_test").c_str());
+    CFileSystem::removeDirectory(lzDir.c_str());
+}
+
+LOAD_TEST(btunittest, compressed_bson)
+{
+    if (format != behaviac::Workspace::EFF_bson)
+    {
+        return;
+    }
+
+    exec_action_noop_ut_0(format, &setup_compressed_bson);
+}
+
+LOAD_TEST(btunittest, preload_all_mixed_formats)
+{
+    //the format is combined, the result doesn't depend on the running one
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    AgentNodeTest* myTestAgent = initTestEnvNode("node_test/action_noop_ut_0", format);
+
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string exportPath = pWorkspace->GetFilePath();
+    behaviac::string dir = GetTestTempPath("btunittest_preload_mixed");
+    behaviac::string xmlPath = dir + "/node_test/wait_ut_0.xml";
+    behaviac::string bsonPath = dir + "/node_test/wait_ut_1.bson.bytes";
+    behaviac::string metaPath = dir + "/behaviac.bb.xml";
+
+    //one tree is only exported as xml and the other one only as bson
+    CFileSystem::MakeSureDirectoryExist((dir + "/node_test/").c_str());
+
+    behaviac::vector<char> content;
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "node_test/wait_ut_0.xml").c_str(), content);
+    WriteTestFile(xmlPath.c_str(), content);
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "node_test/wait_ut_1.bson.bytes").c_str(), content);
+    WriteTestFile(bsonPath.c_str(), content);
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "behaviac.bb.xml").c_str(), content);
+    WriteTestFile(metaPath.c_str(), content);
+
+    pWorkspace->SetFilePath((dir + "/").c_str());
+    pWorkspace->SetFileFormat(behaviac::Workspace::EFF_default);
+
+    const behaviac::Workspace::BehaviorTrees_t& bts = pWorkspace->GetBehaviorTrees();
+    size_t loadedCount = bts.size();
+
+    CFileManager::Cleanup();
+    CFileManager_Counting* pFileManager = BEHAVIAC_NEW CFileManager_Counting("node_test/wait_ut_");
+
+    CHECK_EQUAL(true, pWorkspace->PreloadAll(2) >= 2);
+
+    //both of them are read ahead on the preloading threads, each in its own format
+    CHECK_EQUAL(2, pFileManager->m_opened);
+    CHECK_EQUAL(loadedCount, pFileManager->m_treesAtOpen);
+
+    CHECK_EQUAL(true, bts.find("node_test/wait_ut_0") != bts.end());
+    CHECK_EQUAL(true, bts.find("node_test/wait_ut_1") != bts.end());
+
+    BEHAVIAC_DELETE(pFileManager);
+
+    pWorkspace->SetFileFormat(format);
+    pWorkspace->SetFilePath(exportPath.c_str());
+
+    CFileSystem::Delete(xmlPath.c_str(), false);
+    CFileSystem::Delete(bsonPath.c_str(), false);
+    CFileSystem::Delete(metaPath.c_str(), false);
+    CFileSystem::removeDirectory((dir + "/node_test").c_str());
+    CFileSystem::removeDirectory(dir.c_str());
+
+    finlTestEnvNode(myTestAgent);
+}
+
+//node_test/hot_reload_ut, a parallel running a sequence ending with a wait and a wait, followed by an action
+static void WriteHotReloadTree(const char* path, int waitTime, int siblingWaitTime, int lastValue)
+{
+    const char* content = FormatString(
+                              "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+                              "<behavior name=\"node_test/hot_reload_ut\" agenttype=\"AgentNodeTest\" version=\"3\">\n"
+                              "  <node class=\"Sequence\" id=\"0\">\n"
+                              "    <node class=\"Parallel\" id=\"1\">\n"
+                              "      <property ChildFinishPolicy=\"CHILDFINISH_ONCE\" />\n"
+                              "      <property ExitPolicy=\"EXIT_NONE\" />\n"
+                              "      <property FailurePolicy=\"FAIL_ON_ONE\" />\n"
+                              "      <property SuccessPolicy=\"SUCCEED_ON_ALL\" />\n"
+                              "      <node class=\"Sequence\" id=\"2\">\n"
+                              "        <node class=\"Action\" id=\"3\">\n"
+                              "          <property Method=\"Self.AgentNodeTest::setTestVar_0(1)\" />\n"
+                              "          <property ResultOption=\"BT_SUCCESS\" />\n"
+                              "        </node>\n"
+                              "        <node class=\"Wait\" id=\"4\">\n"
+                              "          <property IgnoreTimeScale=\"true\" />\n"
+                              "          <property Time=\"const float %d\" />\n"
+                              "        </node>\n"
+                              "      </node>\n"
+                              "      <node class=\"Wait\" id=\"5\">\n"
+                              "        <property IgnoreTimeScale=\"true\" />\n"
+                              "        <property Time=\"const float %d\" />\n"
+                              "      </node>\n"
+                              "    </node>\n"
+                              "    <node class=\"Action\" id=\"6\">\n"
+                              "      <property Method=\"Self.AgentNodeTest::setTestVar_0(%d)\" />\n"
+                              "      <property ResultOption=\"BT_SUCCESS\" />\n"
+                              "    </node>\n"
+                              "  </node>\n"
+                              "</behavior>\n", waitTime, siblingWaitTime, lastValue);
+
+    behaviac::vector<char> buffer;
+    buffer.insert(buffer.end(), content, content + strlen(content));
+    WriteTestFile(path, buffer);
+}
+
+LOAD_TEST(btunittest, hot_reload_edited)
+{
+#if BEHAVIAC_ENABLE_HOTRELOAD
+    //the edited tree is written as xml
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    const char* treePath = "node_test/hot_reload_ut";
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string exportPath = pWorkspace->GetFilePath();
+    behaviac::string dir = GetTestTempPath("btunittest_hot_reload");
+    behaviac::string filePath = dir + "/node_test/hot_reload_ut.xml";
+    behaviac::string metaPath = dir + "/behaviac.bb.xml";
+
+    CFileSystem::MakeSureDirectoryExist((dir + "/node_test/").c_str());
+    WriteHotReloadTree(filePath.c_str(), 1000, 1000, 2);
+
+    behaviac::vector<char> meta;
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "behaviac.bb.xml").c_str(), meta);
+    WriteTestFile(metaPath.c_str(), meta);
+    pWorkspace->SetFilePath((dir + "/").c_str());
+
+    AgentNodeTest* myTestAgent = initTestEnvNode(treePath, format);
+    myTestAgent->resetProperties();
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(1, myTestAgent->testVar_0);
+
+    const behaviac::BehaviorTreeTask* btTask = myTestAgent->btgetcurrent();
+    const behaviac::BehaviorTask* pWait = btTask->GetTaskById(4);
+    const behaviac::BehaviorTask* pSiblingWait = btTask->GetTaskById(5);
+    const behaviac::BehaviorTask* pLast = btTask->GetTaskById(6);
+    CHECK_EQUAL(behaviac::BT_RUNNING, pWait->GetStatus());
+    CHECK_EQUAL(behaviac::BT_RUNNING, pSiblingWait->GetStatus());
+    CHECK_EQUAL(behaviac::BT_INVALID, pLast->GetStatus());
+
+    //the edited node which is not running is recreated from the reloaded node, the running ones keep their state
+    myTestAgent->testVar_0 = 0;
+    const behaviac::BehaviorNode* pLastNode = pLast->GetNode();
+    WriteHotReloadTree(filePath.c_str(), 1000, 1000, 3);
+    CHECK_EQUAL(true, pWorkspace->HotReload(treePath));
+
+    const behaviac::BehaviorNode* pTree = btTask->GetNode();
+    CHECK_EQUAL(true, btTask == myTestAgent->btgetcurrent());
+    CHECK_EQUAL(true, pWait == btTask->GetTaskById(4));
+    CHECK_EQUAL(true, pSiblingWait == btTask->GetTaskById(5));
+    CHECK_EQUAL(true, pLastNode != btTask->GetTaskById(6)->GetNode());
+    CHECK_EQUAL(true, pTree->GetChild(0)->GetChild(1) == btTask->GetTaskById(6)->GetNode());
+    CHECK_EQUAL(behaviac::BT_RUNNING, pWait->GetStatus());
+    CHECK_EQUAL(behaviac::BT_RUNNING, pSiblingWait->GetStatus());
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(0, myTestAgent->testVar_0);
+
+    //the edited running wait is restarted, its running sibling sequence is not
+    WriteHotReloadTree(filePath.c_str(), 1000, 2000, 3);
+    CHECK_EQUAL(true, pWorkspace->HotReload(treePath));
+
+    const behaviac::BehaviorTask* pRestartedWait = btTask->GetTaskById(5);
+    CHECK_EQUAL(true, pRestartedWait != pSiblingWait);
+    CHECK_EQUAL(true, pRestartedWait->GetNode() == pTree->GetChild(0)->GetChild(0)->GetChild(1));
+    CHECK_EQUAL(behaviac::BT_INVALID, pRestartedWait->GetStatus());
+    CHECK_EQUAL(true, pWait == btTask->GetTaskById(4));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pWait->GetStatus());
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(behaviac::BT_RUNNING, pRestartedWait->GetStatus());
+    CHECK_EQUAL(0, myTestAgent->testVar_0);
+
+    //the edited wait in the running sequence restarts the sequence, the action before it is executed again
+    WriteHotReloadTree(filePath.c_str(), 2000, 2000, 3);
+    CHECK_EQUAL(true, pWorkspace->HotReload(treePath));
+
+    CHECK_EQUAL(true, pRestartedWait == btTask->GetTaskById(5));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pRestartedWait->GetStatus());
+    CHECK_EQUAL(behaviac::BT_INVALID, btTask->GetTaskById(2)->GetStatus());
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(1, myTestAgent->testVar_0);
+    CHECK_EQUAL(behaviac::BT_RUNNING, btTask->GetTaskById(4)->GetStatus());
+    CHECK_EQUAL(true, pRestartedWait == btTask->GetTaskById(5));
+
+    finlTestEnvNode(myTestAgent);
+
+    pWorkspace->SetFilePath(exportPath.c_str());
+
+    CFileSystem::Delete(filePath.c_str(), false);
+    CFileSystem::Delete(metaPath.c_str(), false);
+    CFileSystem::removeDirectory((dir + "/node_test").c_str());
+    CFileSystem::removeDirectory(dir.c_str());
+#else
+    BEHAVIAC_UNUSED_VAR(format);
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+}
+
+LOAD_TEST(btunittest, hot_reload_async_update)
+{
+#if BEHAVIAC_ENABLE_HOTRELOAD
+    //the edited tree is written as xml
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    const char* treePath = "node_test/hot_reload_ut";
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string exportPath = pWorkspace->GetFilePath();
+    behaviac::string dir = GetTestTempPath("btunittest_hot_reload_async");
+    behaviac::string filePath = dir + "/node_test/hot_reload_ut.xml";
+    behaviac::string metaPath = dir + "/behaviac.bb.xml";
+
+    CFileSystem::MakeSureDirectoryExist((dir + "/node_test/").c_str());
+    WriteHotReloadTree(filePath.c_str(), 1000, 1000, 2);
+
+    behaviac::vector<char> meta;
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "behaviac.bb.xml").c_str(), meta);
+    WriteTestFile(metaPath.c_str(), meta);
+    pWorkspace->SetFilePath((dir + "/").c_str());
+
+    AgentNodeTest* myTestAgent = initTestEnvNode(treePath, format);
+    myTestAgent->resetProperties();
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(1, myTestAgent->testVar_0);
+
+    //Update only swaps the reloaded tree in, the agent is executed here
+    bool bExecAgents = pWorkspace->IsExecAgents();
+    bool bAutoHotReload = pWorkspace->GetAutoHotReload();
+    pWorkspace->SetIsExecAgents(false);
+    pWorkspace->SetAutoHotReload(false);
+
+    const behaviac::BehaviorTreeTask* btTask = myTestAgent->btgetcurrent();
+    const behaviac::BehaviorNode* pTree = btTask->GetNode();
+    const behaviac::BehaviorTask* pWait = btTask->GetTaskById(4);
+    const behaviac::BehaviorNode* pLastNode = btTask->GetTaskById(6)->GetNode();
+
+    myTestAgent->testVar_0 = 0;
+    WriteHotReloadTree(filePath.c_str(), 1000, 1000, 3);
+
+    behaviac::vector<behaviac::string> relativePaths;
+    relativePaths.push_back(treePath);
+
+    {
+        //the worker builds the tree holding the lock of the locals, so it can't be swapped in before the lock is released
+        behaviac::ScopedLock lock(behaviac::AgentProperties::ms_localsCs);
+        pWorkspace->HotReloadAsync(relativePaths);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            pWorkspace->Update();
+            behaviac::Thread::Sleep(1);
+        }
+
+        CHECK_EQUAL(true, pLastNode == btTask->GetTaskById(6)->GetNode());
+    }
+
+    for (int i = 0; i < 1000 && pLastNode == btTask->GetTaskById(6)->GetNode(); ++i)
+    {
+        pWorkspace->Update();
+        behaviac::Thread::Sleep(1);
+    }
+
+    //the built nodes are swapped into the same tree, the running tasks are kept
+    CHECK_EQUAL(0, pWorkspace->FinishAsyncLoads(true));
+    CHECK_EQUAL(true, pTree == btTask->GetNode());
+    CHECK_EQUAL(true, pLastNode != btTask->GetTaskById(6)->GetNode());
+    CHECK_EQUAL(true, pTree->GetChild(0)->GetChild(1) == btTask->GetTaskById(6)->GetNode());
+    CHECK_EQUAL(true, pWait == btTask->GetTaskById(4));
+    CHECK_EQUAL(behaviac::BT_RUNNING, pWait->GetStatus());
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(0, myTestAgent->testVar_0);
+
+    pWorkspace->SetIsExecAgents(bExecAgents);
+    pWorkspace->SetAutoHotReload(bAutoHotReload);
+
+    finlTestEnvNode(myTestAgent);
+
+    pWorkspace->SetFilePath(exportPath.c_str());
+
+    CFileSystem::Delete(filePath.c_str(), false);
+    CFileSystem::Delete(metaPath.c_str(), false);
+    CFileSystem::removeDirectory((dir + "/node_test").c_str());
+    CFileSystem::removeDirectory(dir.c_str());
+#else
+    BEHAVIAC_UNUSED_VAR(format);
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+}
+
+//node_test/reparent_ut, a sequence ending with a wait
+static void WriteReparentTree(const char* path, int waitTime)
+{
+    const char* content = FormatString(
+                              "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+                              "<behavior name=\"node_test/reparent_ut\" agenttype=\"AgentNodeTest\" version=\"3\">\n"
+                              "  <node class=\"Sequence\" id=\"0\">\n"
+                              "    <node class=\"Action\" id=\"1\">\n"
+                              "      <property Method=\"Self.AgentNodeTest::setTestVar_0(1)\" />\n"
+                              "      <property ResultOption=\"BT_SUCCESS\" />\n"
+                              "    </node>\n"
+                              "    <node class=\"Wait\" id=\"2\">\n"
+                              "      <property IgnoreTimeScale=\"true\" />\n"
+                              "      <property Time=\"const float %d\" />\n"
+                              "    </node>\n"
+                              "  </node>\n"
+                              "</behavior>\n", waitTime);
+
+    behaviac::vector<char> buffer;
+    buffer.insert(buffer.end(), content, content + strlen(content));
+    WriteTestFile(path, buffer);
+}
+
+LOAD_TEST(btunittest, reparent_top_branch)
+{
+#if BEHAVIAC_ENABLE_HOTRELOAD
+    //the edited tree is written as xml
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    const char* treePath = "node_test/reparent_ut";
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string exportPath = pWorkspace->GetFilePath();
+    behaviac::string dir = GetTestTempPath("btunittest_reparent");
+    behaviac::string filePath = dir + "/node_test/reparent_ut.xml";
+    behaviac::string metaPath = dir + "/behaviac.bb.xml";
+
+    CFileSystem::MakeSureDirectoryExist((dir + "/node_test/").c_str());
+    WriteReparentTree(filePath.c_str(), 1000);
+
+    behaviac::vector<char> meta;
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "behaviac.bb.xml").c_str(), meta);
+    WriteTestFile(metaPath.c_str(), meta);
+    pWorkspace->SetFilePath((dir + "/").c_str());
+
+    AgentNodeTest* myTestAgent = initTestEnvNode(treePath, format);
+    myTestAgent->resetProperties();
+
+    behaviac::BehaviorTreeTask* btTask = (behaviac::BehaviorTreeTask*)myTestAgent->btgetcurrent();
+    behaviac::BehaviorTreeTask* pOuterTask = pWorkspace->CreateBehaviorTreeTask(treePath);
+    behaviac::BehaviorTreeTask* pOtherTask = pWorkspace->CreateBehaviorTreeTask(treePath);
+
+    //a running tree task records itself as the current task of the tree it is a child of
+    btTask->SetParent(pOuterTask);
+    CHECK_EQUAL(behaviac::BT_RUNNING, btTask->exec(myTestAgent));
+    CHECK_EQUAL(true, pOuterTask->GetCurrentTask() == btTask);
+
+    //the branch resolved before is not used once the task is moved to another parent
+    btTask->SetParent(pOtherTask);
+    CHECK_EQUAL(behaviac::BT_RUNNING, btTask->exec(myTestAgent));
+    CHECK_EQUAL(true, pOtherTask->GetCurrentTask() == btTask);
+
+    //the edited running wait restarts the tree tasks, which are cleared and so have no parent any more
+    WriteReparentTree(filePath.c_str(), 2000);
+    CHECK_EQUAL(true, pWorkspace->HotReload(treePath));
+    CHECK_EQUAL(true, btTask->GetParent() == 0);
+
+    pOuterTask->SetCurrentTask(0);
+    pOtherTask->SetCurrentTask(0);
+
+    CHECK_EQUAL(behaviac::BT_RUNNING, btTask->exec(myTestAgent));
+    CHECK_EQUAL(true, pOtherTask->GetCurrentTask() == 0);
+    CHECK_EQUAL(true, pOuterTask->GetCurrentTask() == 0);
+
+    pWorkspace->DestroyBehaviorTreeTask(pOuterTask, myTestAgent);
+    pWorkspace->DestroyBehaviorTreeTask(pOtherTask, myTestAgent);
+
+    finlTestEnvNode(myTestAgent);
+
+    pWorkspace->SetFilePath(exportPath.c_str());
+
+    CFileSystem::Delete(filePath.c_str(), false);
+    CFileSystem::Delete(metaPath.c_str(), false);
+    CFileSystem::removeDirectory((dir + "/node_test").c_str());
+    CFileSystem::removeDirectory(dir.c_str());
+#else
+    BEHAVIAC_UNUSED_VAR(format);
+#endif//BEHAVIAC_ENABLE_HOTRELOAD
+}
+
+//node_test/compute_method_ut, testVar_3 = setTestVar_R() + 0.5
+static void WriteComputeMethodTree(const char* path)
+{
+    const char* content =
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+        "<behavior name=\"node_test/compute_method_ut\" agenttype=\"AgentNodeTest\" version=\"3\">\n"
+        "  <node class=\"Compute\" id=\"0\">\n"
+        "    <property Operator=\"Add\" />\n"
+        "    <property Opl=\"float Self.AgentNodeTest::testVar_3\" />\n"
+        "    <property Opr1=\"Self.AgentNodeTest::setTestVar_R()\" />\n"
+        "    <property Opr2=\"const float 0.5\" />\n"
+        "  </node>\n"
+        "</behavior>\n";
+
+    behaviac::vector<char> buffer;
+    buffer.insert(buffer.end(), content, content + strlen(content));
+    WriteTestFile(path, buffer);
+}
+
+LOAD_TEST(btunittest, compute_method_operand)
+{
+    //the tree is written as xml
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    const char* treePath = "node_test/compute_method_ut";
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string exportPath = pWorkspace->GetFilePath();
+    behaviac::string dir = GetTestTempPath("btunittest_compute_method");
+    behaviac::string filePath = dir + "/node_test/compute_method_ut.xml";
+    behaviac::string metaPath = dir + "/behaviac.bb.xml";
+
+    CFileSystem::MakeSureDirectoryExist((dir + "/node_test/").c_str());
+    WriteComputeMethodTree(filePath.c_str());
+
+    behaviac::vector<char> meta;
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "behaviac.bb.xml").c_str(), meta);
+    WriteTestFile(metaPath.c_str(), meta);
+    pWorkspace->SetFilePath((dir + "/").c_str());
+
+    AgentNodeTest* myTestAgent = initTestEnvNode(treePath, format);
+    myTestAgent->resetProperties();
+
+    //the method operand is called on each exec, its value is not the one returned by a previous call
+    myTestAgent->testVar_0 = 1;
+    myTestAgent->testVar_2 = 2.0f;
+    CHECK_EQUAL(behaviac::BT_SUCCESS, myTestAgent->btexec());
+    CHECK_FLOAT_EQUAL(3.5f, myTestAgent->testVar_3);
+
+    myTestAgent->testVar_2 = 5.0f;
+    CHECK_EQUAL(behaviac::BT_SUCCESS, myTestAgent->btexec());
+    CHECK_FLOAT_EQUAL(6.5f, myTestAgent->testVar_3);
+
+    finlTestEnvNode(myTestAgent);
+
+    pWorkspace->SetFilePath(exportPath.c_str());
+
+    CFileSystem::Delete(filePath.c_str(), false);
+    CFileSystem::Delete(metaPath.c_str(), false);
+    CFileSystem::removeDirectory((dir + "/node_test").c_str());
+    CFileSystem::removeDirectory(dir.c_str());
+}
+
+//node_test/parallel_event_ut, a parallel running a sequence handling event_test_void and a wait
+static void WriteParallelEventTree(const char* path)
+{
+    const char* content =
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+        "<behavior name=\"node_test/parallel_event_ut\" agenttype=\"AgentNodeTest\" version=\"3\">\n"
+        "  <node class=\"Parallel\" id=\"0\">\n"
+        "    <property ChildFinishPolicy=\"CHILDFINISH_ONCE\" />\n"
+        "    <property ExitPolicy=\"EXIT_NONE\" />\n"
+        "    <property FailurePolicy=\"FAIL_ON_ONE\" />\n"
+        "    <property SuccessPolicy=\"SUCCEED_ON_ALL\" />\n"
+        "    <node class=\"Sequence\" id=\"1\">\n"
+        "      <attachment class=\"Event\" id=\"2\" flag=\"event\">\n"
+        "        <property ReferenceFilename=\"node_test/event_subtree_0\" />\n"
+        "        <property Task=\"Self.AgentNodeTest::event_test_void()\" />\n"
+        "        <property TriggeredOnce=\"false\" />\n"
+        "        <property TriggerMode=\"Return\" />\n"
+        "      </attachment>\n"
+        "      <node class=\"WaitforSignal\" id=\"3\">\n"
+        "        <custom>\n"
+        "          <node class=\"Condition\" id=\"4\">\n"
+        "            <property Operator=\"Equal\" />\n"
+        "            <property Opl=\"int Self.AgentNodeTest::testVar_0\" />\n"
+        "            <property Opr=\"const int 0\" />\n"
+        "          </node>\n"
+        "        </custom>\n"
+        "      </node>\n"
+        "    </node>\n"
+        "    <node class=\"Wait\" id=\"5\">\n"
+        "      <property IgnoreTimeScale=\"true\" />\n"
+        "      <property Time=\"const float 1000\" />\n"
+        "    </node>\n"
+        "  </node>\n"
+        "</behavior>\n";
+
+    behaviac::vector<char> buffer;
+    buffer.insert(buffer.end(), content, content + strlen(content));
+    WriteTestFile(path, buffer);
+}
+
+LOAD_TEST(btunittest, parallel_event_listeners)
+{
+    //the tree is written as xml
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    const char* treePath = "node_test/parallel_event_ut";
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string exportPath = pWorkspace->GetFilePath();
+    behaviac::string dir = GetTestTempPath("btunittest_parallel_event");
+    behaviac::string filePath = dir + "/node_test/parallel_event_ut.xml";
+    behaviac::string subtreePath = dir + "/node_test/event_subtree_0.xml";
+    behaviac::string metaPath = dir + "/behaviac.bb.xml";
+
+    CFileSystem::MakeSureDirectoryExist((dir + "/node_test/").c_str());
+    WriteParallelEventTree(filePath.c_str());
+
+    behaviac::vector<char> buffer;
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "node_test/event_subtree_0.xml").c_str(), buffer);
+    WriteTestFile(subtreePath.c_str(), buffer);
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "behaviac.bb.xml").c_str(), buffer);
+    WriteTestFile(metaPath.c_str(), buffer);
+    pWorkspace->SetFilePath((dir + "/").c_str());
+
+    AgentNodeTest* myTestAgent = initTestEnvNode(treePath, format);
+    myTestAgent->resetProperties();
+
+    CStringID eventId("event_test_void");
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(true, myTestAgent->HasEventListeners(eventId));
+
+    //the running sequence under the parallel handles the event, the current tasks walked from the tree didn't reach it
+    myTestAgent->FireEvent("event_test_void");
+    CHECK_EQUAL(true, myTestAgent->event_test_var_bool);
+
+    //the sequence is exited while the parallel keeps running, its events are not handled any more
+    myTestAgent->testVar_0 = 0;
+    CHECK_EQUAL(behaviac::BT_RUNNING, myTestAgent->btexec());
+    CHECK_EQUAL(false, myTestAgent->HasEventListeners(eventId));
+
+    myTestAgent->event_test_var_bool = false;
+    myTestAgent->FireEvent("event_test_void");
+    CHECK_EQUAL(false, myTestAgent->event_test_var_bool);
+
+    finlTestEnvNode(myTestAgent);
+
+    pWorkspace->SetFilePath(exportPath.c_str());
+
+    CFileSystem::Delete(filePath.c_str(), false);
+    CFileSystem::Delete(subtreePath.c_str(), false);
+    CFileSystem::Delete(metaPath.c_str(), false);
+    CFileSystem::removeDirectory((dir + "/node_test").c_str());
+    CFileSystem::removeDirectory(dir.c_str());
+}
+
+//node_test/selector_probability_weights_ut, the first weight is testVar_1 and the random value is testVar_2
+static void WriteSelectorProbabilityTree(const char* path)
+{
+    const char* content =
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+        "<behavior name=\"node_test/selector_probability_weights_ut\" agenttype=\"AgentNodeTest\" version=\"3\">\n"
+        "  <node class=\"SelectorProbability\" id=\"0\">\n"
+        "    <property RandomGenerator=\"Self.AgentNodeTest::getTestVar_2()\" />\n"
+        "    <node class=\"DecoratorWeight\" id=\"1\">\n"
+        "      <property DecorateWhenChildEnds=\"false\" />\n"
+        "      <property Weight=\"int Self.AgentNodeTest::testVar_1\" />\n"
+        "      <node class=\"Action\" id=\"2\">\n"
+        "        <property Method=\"Self.AgentNodeTest::setTestVar_0(0)\" />\n"
+        "        <property ResultOption=\"BT_SUCCESS\" />\n"
+        "      </node>\n"
+        "    </node>\n"
+        "    <node class=\"DecoratorWeight\" id=\"3\">\n"
+        "      <property DecorateWhenChildEnds=\"false\" />\n"
+        "      <property Weight=\"const int 1\" />\n"
+        "      <node class=\"Action\" id=\"4\">\n"
+        "        <property Method=\"Self.AgentNodeTest::setTestVar_0(1)\" />\n"
+        "        <property ResultOption=\"BT_SUCCESS\" />\n"
+        "      </node>\n"
+        "    </node>\n"
+        "    <node class=\"DecoratorWeight\" id=\"5\">\n"
+        "      <property DecorateWhenChildEnds=\"false\" />\n"
+        "      <property Weight=\"const int 0\" />\n"
+        "      <node class=\"Action\" id=\"6\">\n"
+        "        <property Method=\"Self.AgentNodeTest::setTestVar_0(2)\" />\n"
+        "        <property ResultOption=\"BT_SUCCESS\" />\n"
+        "      </node>\n"
+        "    </node>\n"
+        "    <node class=\"DecoratorWeight\" id=\"7\">\n"
+        "      <property DecorateWhenChildEnds=\"false\" />\n"
+        "      <property Weight=\"const int 1\" />\n"
+        "      <node class=\"Action\" id=\"8\">\n"
+        "        <property Method=\"Self.AgentNodeTest::setTestVar_0(3)\" />\n"
+        "        <property ResultOption=\"BT_SUCCESS\" />\n"
+        "      </node>\n"
+        "    </node>\n"
+        "  </node>\n"
+        "</behavior>\n";
+
+    behaviac::vector<char> buffer;
+    buffer.insert(buffer.end(), content, content + strlen(content));
+    WriteTestFile(path, buffer);
+}
+
+//the random values are swept evenly over [0, 1), each child is picked in proportion to its weight
+static void SweepSelectorProbability(AgentNodeTest* myTestAgent, int counts[4])
+{
+    const int kSteps = 4000;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        counts[i] = 0;
+    }
+
+    for (int k = 0; k < kSteps; ++k)
+    {
+        myTestAgent->testVar_0 = -1;
+        myTestAgent->testVar_2 = (float)k / kSteps;
+
+        CHECK_EQUAL(behaviac::BT_SUCCESS, myTestAgent->btexec());
+        CHECK_EQUAL(true, myTestAgent->testVar_0 >= 0 && myTestAgent->testVar_0 < 4);
+
+        ++(counts[myTestAgent->testVar_0]);
+    }
+}
+
+LOAD_TEST(btunittest, selector_probability_weights)
+{
+    //the tree is written as xml
+    if (format != behaviac::Workspace::EFF_xml)
+    {
+        return;
+    }
+
+    const char* treePath = "node_test/selector_probability_weights_ut";
+    behaviac::Workspace* pWorkspace = behaviac::Workspace::GetInstance();
+    behaviac::string exportPath = pWorkspace->GetFilePath();
+    behaviac::string dir = GetTestTempPath("btunittest_selector_probability");
+    behaviac::string filePath = dir + "/node_test/selector_probability_weights_ut.xml";
+    behaviac::string metaPath = dir + "/behaviac.bb.xml";
+
+    CFileSystem::MakeSureDirectoryExist((dir + "/node_test/").c_str());
+    WriteSelectorProbabilityTree(filePath.c_str());
+
+    behaviac::vector<char> meta;
+    ReadTestFile(behaviac::StringUtils::CombineDir(exportPath.c_str(), "behaviac.bb.xml").c_str(), meta);
+    WriteTestFile(metaPath.c_str(), meta);
+    pWorkspace->SetFilePath((dir + "/").c_str());
+
+    AgentNodeTest* myTestAgent = initTestEnvNode(treePath, format);
+    myTestAgent->resetProperties();
+
+    int counts[4];
+
+    //the children of weight 0 are never picked, not even at the boundaries of their columns
+    myTestAgent->testVar_1 = 0;
+    SweepSelectorProbability(myTestAgent, counts);
+    CHECK_EQUAL(0, counts[0]);
+    CHECK_EQUAL(2000, counts[1]);
+    CHECK_EQUAL(0, counts[2]);
+    CHECK_EQUAL(2000, counts[3]);
+
+    //a changed weight rebuilds the alias table when the node is entered again
+    myTestAgent->testVar_1 = 2;
+    SweepSelectorProbability(myTestAgent, counts);
+    CHECK_EQUAL(2000, counts[0]);
+    CHECK_EQUAL(1000, counts[1]);
+    CHECK_EQUAL(0, counts[2]);
+    CHECK_EQUAL(1000, counts[3]);
+
+    //and so does the weight going back to 0, a negative weight is never picked either
+    myTestAgent->testVar_1 = 0;
+    SweepSelectorProbability(myTestAgent, counts);
+    CHECK_EQUAL(0, counts[0]);
+    CHECK_EQUAL(2000, counts[1]);
+    CHECK_EQUAL(2000, counts[3]);
+
+    myTestAgent->testVar_1 = -1;
+    SweepSelectorProbability(myTestAgent, counts);
+    CHECK_EQUAL(0, counts[0]);
+    CHECK_EQUAL(0, counts[2]);
+
+    finlTestEnvNode(myTestAgent);
+
+    pWorkspace->SetFilePath(exportPath.c_str());
+
+    CFileSystem::Delete(filePath.c_str(), false);
+    CFileSystem::Delete(metaPath.c_str(), false);
+    CFileSystem::removeDirectory((dir + "/node_test").c_str());
+    CFileSystem::removeDirectory(dir.c_str());
+}
+
 TEST(btunittest, loadtest)
 {
     behaviac::Profiler::GetInstance();
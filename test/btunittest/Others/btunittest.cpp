@@ -21,6 +21,7 @@
 #include "behaviac/behaviortree/nodes/composites/query.h"
 
 #include "behaviac/behaviortree/generator.h"
+#include "behaviac/base/core/lz.h"
 
 TEST(btunittest, coroutine)
 {
@@ -106,3 +107,43 @@ TEST(btunittest, stringconvert)
 
     CHECK_EQUAL(0, wcscmp(wstr.c_str(), ws.c_str()));
 }
+
+TEST(btunittest, lz)
+{
+    //the repeated, the overlapped and the incompressible data
+    const uint32_t kSize = 200 * 1024;
+    behaviac::vector<char> data;
+    data.resize(kSize);
+    uint32_t seed = 1;
+
+    for (uint32_t i = 0; i < kSize; ++i)
+    {
+        if (i < kSize / 3)
+        {
+            data[i] = "behaviac"[i % 8];
+        }
+        else if (i < kSize * 2 / 3)
+        {
+            data[i] = 'a';
+        }
+        else
+        {
+            seed = seed * 1103515245 + 12345;
+            data[i] = (char)(seed >> 16);
+        }
+    }
+
+    behaviac::vector<char> compressed;
+    compressed.resize(LZ::CompressBound(kSize));
+    uint32_t compressedSize = LZ::Compress(&data[0], kSize, &compressed[0], (uint32_t)compressed.size());
+    CHECK_EQUAL(true, compressedSize > 0 && compressedSize < kSize);
+
+    behaviac::vector<char> decompressed;
+    decompressed.resize(kSize);
+    CHECK_EQUAL(true, LZ::Decompress(&compressed[0], compressedSize, &decompressed[0], kSize));
+    CHECK_EQUAL(0, memcmp(&data[0], &decompressed[0], kSize));
+
+    //the truncated data is rejected
+    CHECK_EQUAL(false, LZ::Decompress(&compressed[0], compressedSize / 2, &decompressed[0], kSize));
+    CHECK_EQUAL(0, (int)LZ::Compress(&data[0], kSize, &compressed[0], 16));
+}